@@ -0,0 +1,2012 @@
+# Append benchmark: lists built from 2,000 += lines
+#
+#  time CMake -f append.mk append
+#
+SRCS :=
+OBJS =
+
+SRCS += src/dir1/file1.cpp
+OBJS += $(OBJDIR)/file1.o
+SRCS += src/dir2/file2.cpp
+OBJS += $(OBJDIR)/file2.o
+SRCS += src/dir3/file3.cpp
+OBJS += $(OBJDIR)/file3.o
+SRCS += src/dir4/file4.cpp
+OBJS += $(OBJDIR)/file4.o
+SRCS += src/dir5/file5.cpp
+OBJS += $(OBJDIR)/file5.o
+SRCS += src/dir6/file6.cpp
+OBJS += $(OBJDIR)/file6.o
+SRCS += src/dir7/file7.cpp
+OBJS += $(OBJDIR)/file7.o
+SRCS += src/dir8/file8.cpp
+OBJS += $(OBJDIR)/file8.o
+SRCS += src/dir9/file9.cpp
+OBJS += $(OBJDIR)/file9.o
+SRCS += src/dir0/file10.cpp
+OBJS += $(OBJDIR)/file10.o
+SRCS += src/dir1/file11.cpp
+OBJS += $(OBJDIR)/file11.o
+SRCS += src/dir2/file12.cpp
+OBJS += $(OBJDIR)/file12.o
+SRCS += src/dir3/file13.cpp
+OBJS += $(OBJDIR)/file13.o
+SRCS += src/dir4/file14.cpp
+OBJS += $(OBJDIR)/file14.o
+SRCS += src/dir5/file15.cpp
+OBJS += $(OBJDIR)/file15.o
+SRCS += src/dir6/file16.cpp
+OBJS += $(OBJDIR)/file16.o
+SRCS += src/dir7/file17.cpp
+OBJS += $(OBJDIR)/file17.o
+SRCS += src/dir8/file18.cpp
+OBJS += $(OBJDIR)/file18.o
+SRCS += src/dir9/file19.cpp
+OBJS += $(OBJDIR)/file19.o
+SRCS += src/dir0/file20.cpp
+OBJS += $(OBJDIR)/file20.o
+SRCS += src/dir1/file21.cpp
+OBJS += $(OBJDIR)/file21.o
+SRCS += src/dir2/file22.cpp
+OBJS += $(OBJDIR)/file22.o
+SRCS += src/dir3/file23.cpp
+OBJS += $(OBJDIR)/file23.o
+SRCS += src/dir4/file24.cpp
+OBJS += $(OBJDIR)/file24.o
+SRCS += src/dir5/file25.cpp
+OBJS += $(OBJDIR)/file25.o
+SRCS += src/dir6/file26.cpp
+OBJS += $(OBJDIR)/file26.o
+SRCS += src/dir7/file27.cpp
+OBJS += $(OBJDIR)/file27.o
+SRCS += src/dir8/file28.cpp
+OBJS += $(OBJDIR)/file28.o
+SRCS += src/dir9/file29.cpp
+OBJS += $(OBJDIR)/file29.o
+SRCS += src/dir0/file30.cpp
+OBJS += $(OBJDIR)/file30.o
+SRCS += src/dir1/file31.cpp
+OBJS += $(OBJDIR)/file31.o
+SRCS += src/dir2/file32.cpp
+OBJS += $(OBJDIR)/file32.o
+SRCS += src/dir3/file33.cpp
+OBJS += $(OBJDIR)/file33.o
+SRCS += src/dir4/file34.cpp
+OBJS += $(OBJDIR)/file34.o
+SRCS += src/dir5/file35.cpp
+OBJS += $(OBJDIR)/file35.o
+SRCS += src/dir6/file36.cpp
+OBJS += $(OBJDIR)/file36.o
+SRCS += src/dir7/file37.cpp
+OBJS += $(OBJDIR)/file37.o
+SRCS += src/dir8/file38.cpp
+OBJS += $(OBJDIR)/file38.o
+SRCS += src/dir9/file39.cpp
+OBJS += $(OBJDIR)/file39.o
+SRCS += src/dir0/file40.cpp
+OBJS += $(OBJDIR)/file40.o
+SRCS += src/dir1/file41.cpp
+OBJS += $(OBJDIR)/file41.o
+SRCS += src/dir2/file42.cpp
+OBJS += $(OBJDIR)/file42.o
+SRCS += src/dir3/file43.cpp
+OBJS += $(OBJDIR)/file43.o
+SRCS += src/dir4/file44.cpp
+OBJS += $(OBJDIR)/file44.o
+SRCS += src/dir5/file45.cpp
+OBJS += $(OBJDIR)/file45.o
+SRCS += src/dir6/file46.cpp
+OBJS += $(OBJDIR)/file46.o
+SRCS += src/dir7/file47.cpp
+OBJS += $(OBJDIR)/file47.o
+SRCS += src/dir8/file48.cpp
+OBJS += $(OBJDIR)/file48.o
+SRCS += src/dir9/file49.cpp
+OBJS += $(OBJDIR)/file49.o
+SRCS += src/dir0/file50.cpp
+OBJS += $(OBJDIR)/file50.o
+SRCS += src/dir1/file51.cpp
+OBJS += $(OBJDIR)/file51.o
+SRCS += src/dir2/file52.cpp
+OBJS += $(OBJDIR)/file52.o
+SRCS += src/dir3/file53.cpp
+OBJS += $(OBJDIR)/file53.o
+SRCS += src/dir4/file54.cpp
+OBJS += $(OBJDIR)/file54.o
+SRCS += src/dir5/file55.cpp
+OBJS += $(OBJDIR)/file55.o
+SRCS += src/dir6/file56.cpp
+OBJS += $(OBJDIR)/file56.o
+SRCS += src/dir7/file57.cpp
+OBJS += $(OBJDIR)/file57.o
+SRCS += src/dir8/file58.cpp
+OBJS += $(OBJDIR)/file58.o
+SRCS += src/dir9/file59.cpp
+OBJS += $(OBJDIR)/file59.o
+SRCS += src/dir0/file60.cpp
+OBJS += $(OBJDIR)/file60.o
+SRCS += src/dir1/file61.cpp
+OBJS += $(OBJDIR)/file61.o
+SRCS += src/dir2/file62.cpp
+OBJS += $(OBJDIR)/file62.o
+SRCS += src/dir3/file63.cpp
+OBJS += $(OBJDIR)/file63.o
+SRCS += src/dir4/file64.cpp
+OBJS += $(OBJDIR)/file64.o
+SRCS += src/dir5/file65.cpp
+OBJS += $(OBJDIR)/file65.o
+SRCS += src/dir6/file66.cpp
+OBJS += $(OBJDIR)/file66.o
+SRCS += src/dir7/file67.cpp
+OBJS += $(OBJDIR)/file67.o
+SRCS += src/dir8/file68.cpp
+OBJS += $(OBJDIR)/file68.o
+SRCS += src/dir9/file69.cpp
+OBJS += $(OBJDIR)/file69.o
+SRCS += src/dir0/file70.cpp
+OBJS += $(OBJDIR)/file70.o
+SRCS += src/dir1/file71.cpp
+OBJS += $(OBJDIR)/file71.o
+SRCS += src/dir2/file72.cpp
+OBJS += $(OBJDIR)/file72.o
+SRCS += src/dir3/file73.cpp
+OBJS += $(OBJDIR)/file73.o
+SRCS += src/dir4/file74.cpp
+OBJS += $(OBJDIR)/file74.o
+SRCS += src/dir5/file75.cpp
+OBJS += $(OBJDIR)/file75.o
+SRCS += src/dir6/file76.cpp
+OBJS += $(OBJDIR)/file76.o
+SRCS += src/dir7/file77.cpp
+OBJS += $(OBJDIR)/file77.o
+SRCS += src/dir8/file78.cpp
+OBJS += $(OBJDIR)/file78.o
+SRCS += src/dir9/file79.cpp
+OBJS += $(OBJDIR)/file79.o
+SRCS += src/dir0/file80.cpp
+OBJS += $(OBJDIR)/file80.o
+SRCS += src/dir1/file81.cpp
+OBJS += $(OBJDIR)/file81.o
+SRCS += src/dir2/file82.cpp
+OBJS += $(OBJDIR)/file82.o
+SRCS += src/dir3/file83.cpp
+OBJS += $(OBJDIR)/file83.o
+SRCS += src/dir4/file84.cpp
+OBJS += $(OBJDIR)/file84.o
+SRCS += src/dir5/file85.cpp
+OBJS += $(OBJDIR)/file85.o
+SRCS += src/dir6/file86.cpp
+OBJS += $(OBJDIR)/file86.o
+SRCS += src/dir7/file87.cpp
+OBJS += $(OBJDIR)/file87.o
+SRCS += src/dir8/file88.cpp
+OBJS += $(OBJDIR)/file88.o
+SRCS += src/dir9/file89.cpp
+OBJS += $(OBJDIR)/file89.o
+SRCS += src/dir0/file90.cpp
+OBJS += $(OBJDIR)/file90.o
+SRCS += src/dir1/file91.cpp
+OBJS += $(OBJDIR)/file91.o
+SRCS += src/dir2/file92.cpp
+OBJS += $(OBJDIR)/file92.o
+SRCS += src/dir3/file93.cpp
+OBJS += $(OBJDIR)/file93.o
+SRCS += src/dir4/file94.cpp
+OBJS += $(OBJDIR)/file94.o
+SRCS += src/dir5/file95.cpp
+OBJS += $(OBJDIR)/file95.o
+SRCS += src/dir6/file96.cpp
+OBJS += $(OBJDIR)/file96.o
+SRCS += src/dir7/file97.cpp
+OBJS += $(OBJDIR)/file97.o
+SRCS += src/dir8/file98.cpp
+OBJS += $(OBJDIR)/file98.o
+SRCS += src/dir9/file99.cpp
+OBJS += $(OBJDIR)/file99.o
+SRCS += src/dir0/file100.cpp
+OBJS += $(OBJDIR)/file100.o
+SRCS += src/dir1/file101.cpp
+OBJS += $(OBJDIR)/file101.o
+SRCS += src/dir2/file102.cpp
+OBJS += $(OBJDIR)/file102.o
+SRCS += src/dir3/file103.cpp
+OBJS += $(OBJDIR)/file103.o
+SRCS += src/dir4/file104.cpp
+OBJS += $(OBJDIR)/file104.o
+SRCS += src/dir5/file105.cpp
+OBJS += $(OBJDIR)/file105.o
+SRCS += src/dir6/file106.cpp
+OBJS += $(OBJDIR)/file106.o
+SRCS += src/dir7/file107.cpp
+OBJS += $(OBJDIR)/file107.o
+SRCS += src/dir8/file108.cpp
+OBJS += $(OBJDIR)/file108.o
+SRCS += src/dir9/file109.cpp
+OBJS += $(OBJDIR)/file109.o
+SRCS += src/dir0/file110.cpp
+OBJS += $(OBJDIR)/file110.o
+SRCS += src/dir1/file111.cpp
+OBJS += $(OBJDIR)/file111.o
+SRCS += src/dir2/file112.cpp
+OBJS += $(OBJDIR)/file112.o
+SRCS += src/dir3/file113.cpp
+OBJS += $(OBJDIR)/file113.o
+SRCS += src/dir4/file114.cpp
+OBJS += $(OBJDIR)/file114.o
+SRCS += src/dir5/file115.cpp
+OBJS += $(OBJDIR)/file115.o
+SRCS += src/dir6/file116.cpp
+OBJS += $(OBJDIR)/file116.o
+SRCS += src/dir7/file117.cpp
+OBJS += $(OBJDIR)/file117.o
+SRCS += src/dir8/file118.cpp
+OBJS += $(OBJDIR)/file118.o
+SRCS += src/dir9/file119.cpp
+OBJS += $(OBJDIR)/file119.o
+SRCS += src/dir0/file120.cpp
+OBJS += $(OBJDIR)/file120.o
+SRCS += src/dir1/file121.cpp
+OBJS += $(OBJDIR)/file121.o
+SRCS += src/dir2/file122.cpp
+OBJS += $(OBJDIR)/file122.o
+SRCS += src/dir3/file123.cpp
+OBJS += $(OBJDIR)/file123.o
+SRCS += src/dir4/file124.cpp
+OBJS += $(OBJDIR)/file124.o
+SRCS += src/dir5/file125.cpp
+OBJS += $(OBJDIR)/file125.o
+SRCS += src/dir6/file126.cpp
+OBJS += $(OBJDIR)/file126.o
+SRCS += src/dir7/file127.cpp
+OBJS += $(OBJDIR)/file127.o
+SRCS += src/dir8/file128.cpp
+OBJS += $(OBJDIR)/file128.o
+SRCS += src/dir9/file129.cpp
+OBJS += $(OBJDIR)/file129.o
+SRCS += src/dir0/file130.cpp
+OBJS += $(OBJDIR)/file130.o
+SRCS += src/dir1/file131.cpp
+OBJS += $(OBJDIR)/file131.o
+SRCS += src/dir2/file132.cpp
+OBJS += $(OBJDIR)/file132.o
+SRCS += src/dir3/file133.cpp
+OBJS += $(OBJDIR)/file133.o
+SRCS += src/dir4/file134.cpp
+OBJS += $(OBJDIR)/file134.o
+SRCS += src/dir5/file135.cpp
+OBJS += $(OBJDIR)/file135.o
+SRCS += src/dir6/file136.cpp
+OBJS += $(OBJDIR)/file136.o
+SRCS += src/dir7/file137.cpp
+OBJS += $(OBJDIR)/file137.o
+SRCS += src/dir8/file138.cpp
+OBJS += $(OBJDIR)/file138.o
+SRCS += src/dir9/file139.cpp
+OBJS += $(OBJDIR)/file139.o
+SRCS += src/dir0/file140.cpp
+OBJS += $(OBJDIR)/file140.o
+SRCS += src/dir1/file141.cpp
+OBJS += $(OBJDIR)/file141.o
+SRCS += src/dir2/file142.cpp
+OBJS += $(OBJDIR)/file142.o
+SRCS += src/dir3/file143.cpp
+OBJS += $(OBJDIR)/file143.o
+SRCS += src/dir4/file144.cpp
+OBJS += $(OBJDIR)/file144.o
+SRCS += src/dir5/file145.cpp
+OBJS += $(OBJDIR)/file145.o
+SRCS += src/dir6/file146.cpp
+OBJS += $(OBJDIR)/file146.o
+SRCS += src/dir7/file147.cpp
+OBJS += $(OBJDIR)/file147.o
+SRCS += src/dir8/file148.cpp
+OBJS += $(OBJDIR)/file148.o
+SRCS += src/dir9/file149.cpp
+OBJS += $(OBJDIR)/file149.o
+SRCS += src/dir0/file150.cpp
+OBJS += $(OBJDIR)/file150.o
+SRCS += src/dir1/file151.cpp
+OBJS += $(OBJDIR)/file151.o
+SRCS += src/dir2/file152.cpp
+OBJS += $(OBJDIR)/file152.o
+SRCS += src/dir3/file153.cpp
+OBJS += $(OBJDIR)/file153.o
+SRCS += src/dir4/file154.cpp
+OBJS += $(OBJDIR)/file154.o
+SRCS += src/dir5/file155.cpp
+OBJS += $(OBJDIR)/file155.o
+SRCS += src/dir6/file156.cpp
+OBJS += $(OBJDIR)/file156.o
+SRCS += src/dir7/file157.cpp
+OBJS += $(OBJDIR)/file157.o
+SRCS += src/dir8/file158.cpp
+OBJS += $(OBJDIR)/file158.o
+SRCS += src/dir9/file159.cpp
+OBJS += $(OBJDIR)/file159.o
+SRCS += src/dir0/file160.cpp
+OBJS += $(OBJDIR)/file160.o
+SRCS += src/dir1/file161.cpp
+OBJS += $(OBJDIR)/file161.o
+SRCS += src/dir2/file162.cpp
+OBJS += $(OBJDIR)/file162.o
+SRCS += src/dir3/file163.cpp
+OBJS += $(OBJDIR)/file163.o
+SRCS += src/dir4/file164.cpp
+OBJS += $(OBJDIR)/file164.o
+SRCS += src/dir5/file165.cpp
+OBJS += $(OBJDIR)/file165.o
+SRCS += src/dir6/file166.cpp
+OBJS += $(OBJDIR)/file166.o
+SRCS += src/dir7/file167.cpp
+OBJS += $(OBJDIR)/file167.o
+SRCS += src/dir8/file168.cpp
+OBJS += $(OBJDIR)/file168.o
+SRCS += src/dir9/file169.cpp
+OBJS += $(OBJDIR)/file169.o
+SRCS += src/dir0/file170.cpp
+OBJS += $(OBJDIR)/file170.o
+SRCS += src/dir1/file171.cpp
+OBJS += $(OBJDIR)/file171.o
+SRCS += src/dir2/file172.cpp
+OBJS += $(OBJDIR)/file172.o
+SRCS += src/dir3/file173.cpp
+OBJS += $(OBJDIR)/file173.o
+SRCS += src/dir4/file174.cpp
+OBJS += $(OBJDIR)/file174.o
+SRCS += src/dir5/file175.cpp
+OBJS += $(OBJDIR)/file175.o
+SRCS += src/dir6/file176.cpp
+OBJS += $(OBJDIR)/file176.o
+SRCS += src/dir7/file177.cpp
+OBJS += $(OBJDIR)/file177.o
+SRCS += src/dir8/file178.cpp
+OBJS += $(OBJDIR)/file178.o
+SRCS += src/dir9/file179.cpp
+OBJS += $(OBJDIR)/file179.o
+SRCS += src/dir0/file180.cpp
+OBJS += $(OBJDIR)/file180.o
+SRCS += src/dir1/file181.cpp
+OBJS += $(OBJDIR)/file181.o
+SRCS += src/dir2/file182.cpp
+OBJS += $(OBJDIR)/file182.o
+SRCS += src/dir3/file183.cpp
+OBJS += $(OBJDIR)/file183.o
+SRCS += src/dir4/file184.cpp
+OBJS += $(OBJDIR)/file184.o
+SRCS += src/dir5/file185.cpp
+OBJS += $(OBJDIR)/file185.o
+SRCS += src/dir6/file186.cpp
+OBJS += $(OBJDIR)/file186.o
+SRCS += src/dir7/file187.cpp
+OBJS += $(OBJDIR)/file187.o
+SRCS += src/dir8/file188.cpp
+OBJS += $(OBJDIR)/file188.o
+SRCS += src/dir9/file189.cpp
+OBJS += $(OBJDIR)/file189.o
+SRCS += src/dir0/file190.cpp
+OBJS += $(OBJDIR)/file190.o
+SRCS += src/dir1/file191.cpp
+OBJS += $(OBJDIR)/file191.o
+SRCS += src/dir2/file192.cpp
+OBJS += $(OBJDIR)/file192.o
+SRCS += src/dir3/file193.cpp
+OBJS += $(OBJDIR)/file193.o
+SRCS += src/dir4/file194.cpp
+OBJS += $(OBJDIR)/file194.o
+SRCS += src/dir5/file195.cpp
+OBJS += $(OBJDIR)/file195.o
+SRCS += src/dir6/file196.cpp
+OBJS += $(OBJDIR)/file196.o
+SRCS += src/dir7/file197.cpp
+OBJS += $(OBJDIR)/file197.o
+SRCS += src/dir8/file198.cpp
+OBJS += $(OBJDIR)/file198.o
+SRCS += src/dir9/file199.cpp
+OBJS += $(OBJDIR)/file199.o
+SRCS += src/dir0/file200.cpp
+OBJS += $(OBJDIR)/file200.o
+SRCS += src/dir1/file201.cpp
+OBJS += $(OBJDIR)/file201.o
+SRCS += src/dir2/file202.cpp
+OBJS += $(OBJDIR)/file202.o
+SRCS += src/dir3/file203.cpp
+OBJS += $(OBJDIR)/file203.o
+SRCS += src/dir4/file204.cpp
+OBJS += $(OBJDIR)/file204.o
+SRCS += src/dir5/file205.cpp
+OBJS += $(OBJDIR)/file205.o
+SRCS += src/dir6/file206.cpp
+OBJS += $(OBJDIR)/file206.o
+SRCS += src/dir7/file207.cpp
+OBJS += $(OBJDIR)/file207.o
+SRCS += src/dir8/file208.cpp
+OBJS += $(OBJDIR)/file208.o
+SRCS += src/dir9/file209.cpp
+OBJS += $(OBJDIR)/file209.o
+SRCS += src/dir0/file210.cpp
+OBJS += $(OBJDIR)/file210.o
+SRCS += src/dir1/file211.cpp
+OBJS += $(OBJDIR)/file211.o
+SRCS += src/dir2/file212.cpp
+OBJS += $(OBJDIR)/file212.o
+SRCS += src/dir3/file213.cpp
+OBJS += $(OBJDIR)/file213.o
+SRCS += src/dir4/file214.cpp
+OBJS += $(OBJDIR)/file214.o
+SRCS += src/dir5/file215.cpp
+OBJS += $(OBJDIR)/file215.o
+SRCS += src/dir6/file216.cpp
+OBJS += $(OBJDIR)/file216.o
+SRCS += src/dir7/file217.cpp
+OBJS += $(OBJDIR)/file217.o
+SRCS += src/dir8/file218.cpp
+OBJS += $(OBJDIR)/file218.o
+SRCS += src/dir9/file219.cpp
+OBJS += $(OBJDIR)/file219.o
+SRCS += src/dir0/file220.cpp
+OBJS += $(OBJDIR)/file220.o
+SRCS += src/dir1/file221.cpp
+OBJS += $(OBJDIR)/file221.o
+SRCS += src/dir2/file222.cpp
+OBJS += $(OBJDIR)/file222.o
+SRCS += src/dir3/file223.cpp
+OBJS += $(OBJDIR)/file223.o
+SRCS += src/dir4/file224.cpp
+OBJS += $(OBJDIR)/file224.o
+SRCS += src/dir5/file225.cpp
+OBJS += $(OBJDIR)/file225.o
+SRCS += src/dir6/file226.cpp
+OBJS += $(OBJDIR)/file226.o
+SRCS += src/dir7/file227.cpp
+OBJS += $(OBJDIR)/file227.o
+SRCS += src/dir8/file228.cpp
+OBJS += $(OBJDIR)/file228.o
+SRCS += src/dir9/file229.cpp
+OBJS += $(OBJDIR)/file229.o
+SRCS += src/dir0/file230.cpp
+OBJS += $(OBJDIR)/file230.o
+SRCS += src/dir1/file231.cpp
+OBJS += $(OBJDIR)/file231.o
+SRCS += src/dir2/file232.cpp
+OBJS += $(OBJDIR)/file232.o
+SRCS += src/dir3/file233.cpp
+OBJS += $(OBJDIR)/file233.o
+SRCS += src/dir4/file234.cpp
+OBJS += $(OBJDIR)/file234.o
+SRCS += src/dir5/file235.cpp
+OBJS += $(OBJDIR)/file235.o
+SRCS += src/dir6/file236.cpp
+OBJS += $(OBJDIR)/file236.o
+SRCS += src/dir7/file237.cpp
+OBJS += $(OBJDIR)/file237.o
+SRCS += src/dir8/file238.cpp
+OBJS += $(OBJDIR)/file238.o
+SRCS += src/dir9/file239.cpp
+OBJS += $(OBJDIR)/file239.o
+SRCS += src/dir0/file240.cpp
+OBJS += $(OBJDIR)/file240.o
+SRCS += src/dir1/file241.cpp
+OBJS += $(OBJDIR)/file241.o
+SRCS += src/dir2/file242.cpp
+OBJS += $(OBJDIR)/file242.o
+SRCS += src/dir3/file243.cpp
+OBJS += $(OBJDIR)/file243.o
+SRCS += src/dir4/file244.cpp
+OBJS += $(OBJDIR)/file244.o
+SRCS += src/dir5/file245.cpp
+OBJS += $(OBJDIR)/file245.o
+SRCS += src/dir6/file246.cpp
+OBJS += $(OBJDIR)/file246.o
+SRCS += src/dir7/file247.cpp
+OBJS += $(OBJDIR)/file247.o
+SRCS += src/dir8/file248.cpp
+OBJS += $(OBJDIR)/file248.o
+SRCS += src/dir9/file249.cpp
+OBJS += $(OBJDIR)/file249.o
+SRCS += src/dir0/file250.cpp
+OBJS += $(OBJDIR)/file250.o
+SRCS += src/dir1/file251.cpp
+OBJS += $(OBJDIR)/file251.o
+SRCS += src/dir2/file252.cpp
+OBJS += $(OBJDIR)/file252.o
+SRCS += src/dir3/file253.cpp
+OBJS += $(OBJDIR)/file253.o
+SRCS += src/dir4/file254.cpp
+OBJS += $(OBJDIR)/file254.o
+SRCS += src/dir5/file255.cpp
+OBJS += $(OBJDIR)/file255.o
+SRCS += src/dir6/file256.cpp
+OBJS += $(OBJDIR)/file256.o
+SRCS += src/dir7/file257.cpp
+OBJS += $(OBJDIR)/file257.o
+SRCS += src/dir8/file258.cpp
+OBJS += $(OBJDIR)/file258.o
+SRCS += src/dir9/file259.cpp
+OBJS += $(OBJDIR)/file259.o
+SRCS += src/dir0/file260.cpp
+OBJS += $(OBJDIR)/file260.o
+SRCS += src/dir1/file261.cpp
+OBJS += $(OBJDIR)/file261.o
+SRCS += src/dir2/file262.cpp
+OBJS += $(OBJDIR)/file262.o
+SRCS += src/dir3/file263.cpp
+OBJS += $(OBJDIR)/file263.o
+SRCS += src/dir4/file264.cpp
+OBJS += $(OBJDIR)/file264.o
+SRCS += src/dir5/file265.cpp
+OBJS += $(OBJDIR)/file265.o
+SRCS += src/dir6/file266.cpp
+OBJS += $(OBJDIR)/file266.o
+SRCS += src/dir7/file267.cpp
+OBJS += $(OBJDIR)/file267.o
+SRCS += src/dir8/file268.cpp
+OBJS += $(OBJDIR)/file268.o
+SRCS += src/dir9/file269.cpp
+OBJS += $(OBJDIR)/file269.o
+SRCS += src/dir0/file270.cpp
+OBJS += $(OBJDIR)/file270.o
+SRCS += src/dir1/file271.cpp
+OBJS += $(OBJDIR)/file271.o
+SRCS += src/dir2/file272.cpp
+OBJS += $(OBJDIR)/file272.o
+SRCS += src/dir3/file273.cpp
+OBJS += $(OBJDIR)/file273.o
+SRCS += src/dir4/file274.cpp
+OBJS += $(OBJDIR)/file274.o
+SRCS += src/dir5/file275.cpp
+OBJS += $(OBJDIR)/file275.o
+SRCS += src/dir6/file276.cpp
+OBJS += $(OBJDIR)/file276.o
+SRCS += src/dir7/file277.cpp
+OBJS += $(OBJDIR)/file277.o
+SRCS += src/dir8/file278.cpp
+OBJS += $(OBJDIR)/file278.o
+SRCS += src/dir9/file279.cpp
+OBJS += $(OBJDIR)/file279.o
+SRCS += src/dir0/file280.cpp
+OBJS += $(OBJDIR)/file280.o
+SRCS += src/dir1/file281.cpp
+OBJS += $(OBJDIR)/file281.o
+SRCS += src/dir2/file282.cpp
+OBJS += $(OBJDIR)/file282.o
+SRCS += src/dir3/file283.cpp
+OBJS += $(OBJDIR)/file283.o
+SRCS += src/dir4/file284.cpp
+OBJS += $(OBJDIR)/file284.o
+SRCS += src/dir5/file285.cpp
+OBJS += $(OBJDIR)/file285.o
+SRCS += src/dir6/file286.cpp
+OBJS += $(OBJDIR)/file286.o
+SRCS += src/dir7/file287.cpp
+OBJS += $(OBJDIR)/file287.o
+SRCS += src/dir8/file288.cpp
+OBJS += $(OBJDIR)/file288.o
+SRCS += src/dir9/file289.cpp
+OBJS += $(OBJDIR)/file289.o
+SRCS += src/dir0/file290.cpp
+OBJS += $(OBJDIR)/file290.o
+SRCS += src/dir1/file291.cpp
+OBJS += $(OBJDIR)/file291.o
+SRCS += src/dir2/file292.cpp
+OBJS += $(OBJDIR)/file292.o
+SRCS += src/dir3/file293.cpp
+OBJS += $(OBJDIR)/file293.o
+SRCS += src/dir4/file294.cpp
+OBJS += $(OBJDIR)/file294.o
+SRCS += src/dir5/file295.cpp
+OBJS += $(OBJDIR)/file295.o
+SRCS += src/dir6/file296.cpp
+OBJS += $(OBJDIR)/file296.o
+SRCS += src/dir7/file297.cpp
+OBJS += $(OBJDIR)/file297.o
+SRCS += src/dir8/file298.cpp
+OBJS += $(OBJDIR)/file298.o
+SRCS += src/dir9/file299.cpp
+OBJS += $(OBJDIR)/file299.o
+SRCS += src/dir0/file300.cpp
+OBJS += $(OBJDIR)/file300.o
+SRCS += src/dir1/file301.cpp
+OBJS += $(OBJDIR)/file301.o
+SRCS += src/dir2/file302.cpp
+OBJS += $(OBJDIR)/file302.o
+SRCS += src/dir3/file303.cpp
+OBJS += $(OBJDIR)/file303.o
+SRCS += src/dir4/file304.cpp
+OBJS += $(OBJDIR)/file304.o
+SRCS += src/dir5/file305.cpp
+OBJS += $(OBJDIR)/file305.o
+SRCS += src/dir6/file306.cpp
+OBJS += $(OBJDIR)/file306.o
+SRCS += src/dir7/file307.cpp
+OBJS += $(OBJDIR)/file307.o
+SRCS += src/dir8/file308.cpp
+OBJS += $(OBJDIR)/file308.o
+SRCS += src/dir9/file309.cpp
+OBJS += $(OBJDIR)/file309.o
+SRCS += src/dir0/file310.cpp
+OBJS += $(OBJDIR)/file310.o
+SRCS += src/dir1/file311.cpp
+OBJS += $(OBJDIR)/file311.o
+SRCS += src/dir2/file312.cpp
+OBJS += $(OBJDIR)/file312.o
+SRCS += src/dir3/file313.cpp
+OBJS += $(OBJDIR)/file313.o
+SRCS += src/dir4/file314.cpp
+OBJS += $(OBJDIR)/file314.o
+SRCS += src/dir5/file315.cpp
+OBJS += $(OBJDIR)/file315.o
+SRCS += src/dir6/file316.cpp
+OBJS += $(OBJDIR)/file316.o
+SRCS += src/dir7/file317.cpp
+OBJS += $(OBJDIR)/file317.o
+SRCS += src/dir8/file318.cpp
+OBJS += $(OBJDIR)/file318.o
+SRCS += src/dir9/file319.cpp
+OBJS += $(OBJDIR)/file319.o
+SRCS += src/dir0/file320.cpp
+OBJS += $(OBJDIR)/file320.o
+SRCS += src/dir1/file321.cpp
+OBJS += $(OBJDIR)/file321.o
+SRCS += src/dir2/file322.cpp
+OBJS += $(OBJDIR)/file322.o
+SRCS += src/dir3/file323.cpp
+OBJS += $(OBJDIR)/file323.o
+SRCS += src/dir4/file324.cpp
+OBJS += $(OBJDIR)/file324.o
+SRCS += src/dir5/file325.cpp
+OBJS += $(OBJDIR)/file325.o
+SRCS += src/dir6/file326.cpp
+OBJS += $(OBJDIR)/file326.o
+SRCS += src/dir7/file327.cpp
+OBJS += $(OBJDIR)/file327.o
+SRCS += src/dir8/file328.cpp
+OBJS += $(OBJDIR)/file328.o
+SRCS += src/dir9/file329.cpp
+OBJS += $(OBJDIR)/file329.o
+SRCS += src/dir0/file330.cpp
+OBJS += $(OBJDIR)/file330.o
+SRCS += src/dir1/file331.cpp
+OBJS += $(OBJDIR)/file331.o
+SRCS += src/dir2/file332.cpp
+OBJS += $(OBJDIR)/file332.o
+SRCS += src/dir3/file333.cpp
+OBJS += $(OBJDIR)/file333.o
+SRCS += src/dir4/file334.cpp
+OBJS += $(OBJDIR)/file334.o
+SRCS += src/dir5/file335.cpp
+OBJS += $(OBJDIR)/file335.o
+SRCS += src/dir6/file336.cpp
+OBJS += $(OBJDIR)/file336.o
+SRCS += src/dir7/file337.cpp
+OBJS += $(OBJDIR)/file337.o
+SRCS += src/dir8/file338.cpp
+OBJS += $(OBJDIR)/file338.o
+SRCS += src/dir9/file339.cpp
+OBJS += $(OBJDIR)/file339.o
+SRCS += src/dir0/file340.cpp
+OBJS += $(OBJDIR)/file340.o
+SRCS += src/dir1/file341.cpp
+OBJS += $(OBJDIR)/file341.o
+SRCS += src/dir2/file342.cpp
+OBJS += $(OBJDIR)/file342.o
+SRCS += src/dir3/file343.cpp
+OBJS += $(OBJDIR)/file343.o
+SRCS += src/dir4/file344.cpp
+OBJS += $(OBJDIR)/file344.o
+SRCS += src/dir5/file345.cpp
+OBJS += $(OBJDIR)/file345.o
+SRCS += src/dir6/file346.cpp
+OBJS += $(OBJDIR)/file346.o
+SRCS += src/dir7/file347.cpp
+OBJS += $(OBJDIR)/file347.o
+SRCS += src/dir8/file348.cpp
+OBJS += $(OBJDIR)/file348.o
+SRCS += src/dir9/file349.cpp
+OBJS += $(OBJDIR)/file349.o
+SRCS += src/dir0/file350.cpp
+OBJS += $(OBJDIR)/file350.o
+SRCS += src/dir1/file351.cpp
+OBJS += $(OBJDIR)/file351.o
+SRCS += src/dir2/file352.cpp
+OBJS += $(OBJDIR)/file352.o
+SRCS += src/dir3/file353.cpp
+OBJS += $(OBJDIR)/file353.o
+SRCS += src/dir4/file354.cpp
+OBJS += $(OBJDIR)/file354.o
+SRCS += src/dir5/file355.cpp
+OBJS += $(OBJDIR)/file355.o
+SRCS += src/dir6/file356.cpp
+OBJS += $(OBJDIR)/file356.o
+SRCS += src/dir7/file357.cpp
+OBJS += $(OBJDIR)/file357.o
+SRCS += src/dir8/file358.cpp
+OBJS += $(OBJDIR)/file358.o
+SRCS += src/dir9/file359.cpp
+OBJS += $(OBJDIR)/file359.o
+SRCS += src/dir0/file360.cpp
+OBJS += $(OBJDIR)/file360.o
+SRCS += src/dir1/file361.cpp
+OBJS += $(OBJDIR)/file361.o
+SRCS += src/dir2/file362.cpp
+OBJS += $(OBJDIR)/file362.o
+SRCS += src/dir3/file363.cpp
+OBJS += $(OBJDIR)/file363.o
+SRCS += src/dir4/file364.cpp
+OBJS += $(OBJDIR)/file364.o
+SRCS += src/dir5/file365.cpp
+OBJS += $(OBJDIR)/file365.o
+SRCS += src/dir6/file366.cpp
+OBJS += $(OBJDIR)/file366.o
+SRCS += src/dir7/file367.cpp
+OBJS += $(OBJDIR)/file367.o
+SRCS += src/dir8/file368.cpp
+OBJS += $(OBJDIR)/file368.o
+SRCS += src/dir9/file369.cpp
+OBJS += $(OBJDIR)/file369.o
+SRCS += src/dir0/file370.cpp
+OBJS += $(OBJDIR)/file370.o
+SRCS += src/dir1/file371.cpp
+OBJS += $(OBJDIR)/file371.o
+SRCS += src/dir2/file372.cpp
+OBJS += $(OBJDIR)/file372.o
+SRCS += src/dir3/file373.cpp
+OBJS += $(OBJDIR)/file373.o
+SRCS += src/dir4/file374.cpp
+OBJS += $(OBJDIR)/file374.o
+SRCS += src/dir5/file375.cpp
+OBJS += $(OBJDIR)/file375.o
+SRCS += src/dir6/file376.cpp
+OBJS += $(OBJDIR)/file376.o
+SRCS += src/dir7/file377.cpp
+OBJS += $(OBJDIR)/file377.o
+SRCS += src/dir8/file378.cpp
+OBJS += $(OBJDIR)/file378.o
+SRCS += src/dir9/file379.cpp
+OBJS += $(OBJDIR)/file379.o
+SRCS += src/dir0/file380.cpp
+OBJS += $(OBJDIR)/file380.o
+SRCS += src/dir1/file381.cpp
+OBJS += $(OBJDIR)/file381.o
+SRCS += src/dir2/file382.cpp
+OBJS += $(OBJDIR)/file382.o
+SRCS += src/dir3/file383.cpp
+OBJS += $(OBJDIR)/file383.o
+SRCS += src/dir4/file384.cpp
+OBJS += $(OBJDIR)/file384.o
+SRCS += src/dir5/file385.cpp
+OBJS += $(OBJDIR)/file385.o
+SRCS += src/dir6/file386.cpp
+OBJS += $(OBJDIR)/file386.o
+SRCS += src/dir7/file387.cpp
+OBJS += $(OBJDIR)/file387.o
+SRCS += src/dir8/file388.cpp
+OBJS += $(OBJDIR)/file388.o
+SRCS += src/dir9/file389.cpp
+OBJS += $(OBJDIR)/file389.o
+SRCS += src/dir0/file390.cpp
+OBJS += $(OBJDIR)/file390.o
+SRCS += src/dir1/file391.cpp
+OBJS += $(OBJDIR)/file391.o
+SRCS += src/dir2/file392.cpp
+OBJS += $(OBJDIR)/file392.o
+SRCS += src/dir3/file393.cpp
+OBJS += $(OBJDIR)/file393.o
+SRCS += src/dir4/file394.cpp
+OBJS += $(OBJDIR)/file394.o
+SRCS += src/dir5/file395.cpp
+OBJS += $(OBJDIR)/file395.o
+SRCS += src/dir6/file396.cpp
+OBJS += $(OBJDIR)/file396.o
+SRCS += src/dir7/file397.cpp
+OBJS += $(OBJDIR)/file397.o
+SRCS += src/dir8/file398.cpp
+OBJS += $(OBJDIR)/file398.o
+SRCS += src/dir9/file399.cpp
+OBJS += $(OBJDIR)/file399.o
+SRCS += src/dir0/file400.cpp
+OBJS += $(OBJDIR)/file400.o
+SRCS += src/dir1/file401.cpp
+OBJS += $(OBJDIR)/file401.o
+SRCS += src/dir2/file402.cpp
+OBJS += $(OBJDIR)/file402.o
+SRCS += src/dir3/file403.cpp
+OBJS += $(OBJDIR)/file403.o
+SRCS += src/dir4/file404.cpp
+OBJS += $(OBJDIR)/file404.o
+SRCS += src/dir5/file405.cpp
+OBJS += $(OBJDIR)/file405.o
+SRCS += src/dir6/file406.cpp
+OBJS += $(OBJDIR)/file406.o
+SRCS += src/dir7/file407.cpp
+OBJS += $(OBJDIR)/file407.o
+SRCS += src/dir8/file408.cpp
+OBJS += $(OBJDIR)/file408.o
+SRCS += src/dir9/file409.cpp
+OBJS += $(OBJDIR)/file409.o
+SRCS += src/dir0/file410.cpp
+OBJS += $(OBJDIR)/file410.o
+SRCS += src/dir1/file411.cpp
+OBJS += $(OBJDIR)/file411.o
+SRCS += src/dir2/file412.cpp
+OBJS += $(OBJDIR)/file412.o
+SRCS += src/dir3/file413.cpp
+OBJS += $(OBJDIR)/file413.o
+SRCS += src/dir4/file414.cpp
+OBJS += $(OBJDIR)/file414.o
+SRCS += src/dir5/file415.cpp
+OBJS += $(OBJDIR)/file415.o
+SRCS += src/dir6/file416.cpp
+OBJS += $(OBJDIR)/file416.o
+SRCS += src/dir7/file417.cpp
+OBJS += $(OBJDIR)/file417.o
+SRCS += src/dir8/file418.cpp
+OBJS += $(OBJDIR)/file418.o
+SRCS += src/dir9/file419.cpp
+OBJS += $(OBJDIR)/file419.o
+SRCS += src/dir0/file420.cpp
+OBJS += $(OBJDIR)/file420.o
+SRCS += src/dir1/file421.cpp
+OBJS += $(OBJDIR)/file421.o
+SRCS += src/dir2/file422.cpp
+OBJS += $(OBJDIR)/file422.o
+SRCS += src/dir3/file423.cpp
+OBJS += $(OBJDIR)/file423.o
+SRCS += src/dir4/file424.cpp
+OBJS += $(OBJDIR)/file424.o
+SRCS += src/dir5/file425.cpp
+OBJS += $(OBJDIR)/file425.o
+SRCS += src/dir6/file426.cpp
+OBJS += $(OBJDIR)/file426.o
+SRCS += src/dir7/file427.cpp
+OBJS += $(OBJDIR)/file427.o
+SRCS += src/dir8/file428.cpp
+OBJS += $(OBJDIR)/file428.o
+SRCS += src/dir9/file429.cpp
+OBJS += $(OBJDIR)/file429.o
+SRCS += src/dir0/file430.cpp
+OBJS += $(OBJDIR)/file430.o
+SRCS += src/dir1/file431.cpp
+OBJS += $(OBJDIR)/file431.o
+SRCS += src/dir2/file432.cpp
+OBJS += $(OBJDIR)/file432.o
+SRCS += src/dir3/file433.cpp
+OBJS += $(OBJDIR)/file433.o
+SRCS += src/dir4/file434.cpp
+OBJS += $(OBJDIR)/file434.o
+SRCS += src/dir5/file435.cpp
+OBJS += $(OBJDIR)/file435.o
+SRCS += src/dir6/file436.cpp
+OBJS += $(OBJDIR)/file436.o
+SRCS += src/dir7/file437.cpp
+OBJS += $(OBJDIR)/file437.o
+SRCS += src/dir8/file438.cpp
+OBJS += $(OBJDIR)/file438.o
+SRCS += src/dir9/file439.cpp
+OBJS += $(OBJDIR)/file439.o
+SRCS += src/dir0/file440.cpp
+OBJS += $(OBJDIR)/file440.o
+SRCS += src/dir1/file441.cpp
+OBJS += $(OBJDIR)/file441.o
+SRCS += src/dir2/file442.cpp
+OBJS += $(OBJDIR)/file442.o
+SRCS += src/dir3/file443.cpp
+OBJS += $(OBJDIR)/file443.o
+SRCS += src/dir4/file444.cpp
+OBJS += $(OBJDIR)/file444.o
+SRCS += src/dir5/file445.cpp
+OBJS += $(OBJDIR)/file445.o
+SRCS += src/dir6/file446.cpp
+OBJS += $(OBJDIR)/file446.o
+SRCS += src/dir7/file447.cpp
+OBJS += $(OBJDIR)/file447.o
+SRCS += src/dir8/file448.cpp
+OBJS += $(OBJDIR)/file448.o
+SRCS += src/dir9/file449.cpp
+OBJS += $(OBJDIR)/file449.o
+SRCS += src/dir0/file450.cpp
+OBJS += $(OBJDIR)/file450.o
+SRCS += src/dir1/file451.cpp
+OBJS += $(OBJDIR)/file451.o
+SRCS += src/dir2/file452.cpp
+OBJS += $(OBJDIR)/file452.o
+SRCS += src/dir3/file453.cpp
+OBJS += $(OBJDIR)/file453.o
+SRCS += src/dir4/file454.cpp
+OBJS += $(OBJDIR)/file454.o
+SRCS += src/dir5/file455.cpp
+OBJS += $(OBJDIR)/file455.o
+SRCS += src/dir6/file456.cpp
+OBJS += $(OBJDIR)/file456.o
+SRCS += src/dir7/file457.cpp
+OBJS += $(OBJDIR)/file457.o
+SRCS += src/dir8/file458.cpp
+OBJS += $(OBJDIR)/file458.o
+SRCS += src/dir9/file459.cpp
+OBJS += $(OBJDIR)/file459.o
+SRCS += src/dir0/file460.cpp
+OBJS += $(OBJDIR)/file460.o
+SRCS += src/dir1/file461.cpp
+OBJS += $(OBJDIR)/file461.o
+SRCS += src/dir2/file462.cpp
+OBJS += $(OBJDIR)/file462.o
+SRCS += src/dir3/file463.cpp
+OBJS += $(OBJDIR)/file463.o
+SRCS += src/dir4/file464.cpp
+OBJS += $(OBJDIR)/file464.o
+SRCS += src/dir5/file465.cpp
+OBJS += $(OBJDIR)/file465.o
+SRCS += src/dir6/file466.cpp
+OBJS += $(OBJDIR)/file466.o
+SRCS += src/dir7/file467.cpp
+OBJS += $(OBJDIR)/file467.o
+SRCS += src/dir8/file468.cpp
+OBJS += $(OBJDIR)/file468.o
+SRCS += src/dir9/file469.cpp
+OBJS += $(OBJDIR)/file469.o
+SRCS += src/dir0/file470.cpp
+OBJS += $(OBJDIR)/file470.o
+SRCS += src/dir1/file471.cpp
+OBJS += $(OBJDIR)/file471.o
+SRCS += src/dir2/file472.cpp
+OBJS += $(OBJDIR)/file472.o
+SRCS += src/dir3/file473.cpp
+OBJS += $(OBJDIR)/file473.o
+SRCS += src/dir4/file474.cpp
+OBJS += $(OBJDIR)/file474.o
+SRCS += src/dir5/file475.cpp
+OBJS += $(OBJDIR)/file475.o
+SRCS += src/dir6/file476.cpp
+OBJS += $(OBJDIR)/file476.o
+SRCS += src/dir7/file477.cpp
+OBJS += $(OBJDIR)/file477.o
+SRCS += src/dir8/file478.cpp
+OBJS += $(OBJDIR)/file478.o
+SRCS += src/dir9/file479.cpp
+OBJS += $(OBJDIR)/file479.o
+SRCS += src/dir0/file480.cpp
+OBJS += $(OBJDIR)/file480.o
+SRCS += src/dir1/file481.cpp
+OBJS += $(OBJDIR)/file481.o
+SRCS += src/dir2/file482.cpp
+OBJS += $(OBJDIR)/file482.o
+SRCS += src/dir3/file483.cpp
+OBJS += $(OBJDIR)/file483.o
+SRCS += src/dir4/file484.cpp
+OBJS += $(OBJDIR)/file484.o
+SRCS += src/dir5/file485.cpp
+OBJS += $(OBJDIR)/file485.o
+SRCS += src/dir6/file486.cpp
+OBJS += $(OBJDIR)/file486.o
+SRCS += src/dir7/file487.cpp
+OBJS += $(OBJDIR)/file487.o
+SRCS += src/dir8/file488.cpp
+OBJS += $(OBJDIR)/file488.o
+SRCS += src/dir9/file489.cpp
+OBJS += $(OBJDIR)/file489.o
+SRCS += src/dir0/file490.cpp
+OBJS += $(OBJDIR)/file490.o
+SRCS += src/dir1/file491.cpp
+OBJS += $(OBJDIR)/file491.o
+SRCS += src/dir2/file492.cpp
+OBJS += $(OBJDIR)/file492.o
+SRCS += src/dir3/file493.cpp
+OBJS += $(OBJDIR)/file493.o
+SRCS += src/dir4/file494.cpp
+OBJS += $(OBJDIR)/file494.o
+SRCS += src/dir5/file495.cpp
+OBJS += $(OBJDIR)/file495.o
+SRCS += src/dir6/file496.cpp
+OBJS += $(OBJDIR)/file496.o
+SRCS += src/dir7/file497.cpp
+OBJS += $(OBJDIR)/file497.o
+SRCS += src/dir8/file498.cpp
+OBJS += $(OBJDIR)/file498.o
+SRCS += src/dir9/file499.cpp
+OBJS += $(OBJDIR)/file499.o
+SRCS += src/dir0/file500.cpp
+OBJS += $(OBJDIR)/file500.o
+SRCS += src/dir1/file501.cpp
+OBJS += $(OBJDIR)/file501.o
+SRCS += src/dir2/file502.cpp
+OBJS += $(OBJDIR)/file502.o
+SRCS += src/dir3/file503.cpp
+OBJS += $(OBJDIR)/file503.o
+SRCS += src/dir4/file504.cpp
+OBJS += $(OBJDIR)/file504.o
+SRCS += src/dir5/file505.cpp
+OBJS += $(OBJDIR)/file505.o
+SRCS += src/dir6/file506.cpp
+OBJS += $(OBJDIR)/file506.o
+SRCS += src/dir7/file507.cpp
+OBJS += $(OBJDIR)/file507.o
+SRCS += src/dir8/file508.cpp
+OBJS += $(OBJDIR)/file508.o
+SRCS += src/dir9/file509.cpp
+OBJS += $(OBJDIR)/file509.o
+SRCS += src/dir0/file510.cpp
+OBJS += $(OBJDIR)/file510.o
+SRCS += src/dir1/file511.cpp
+OBJS += $(OBJDIR)/file511.o
+SRCS += src/dir2/file512.cpp
+OBJS += $(OBJDIR)/file512.o
+SRCS += src/dir3/file513.cpp
+OBJS += $(OBJDIR)/file513.o
+SRCS += src/dir4/file514.cpp
+OBJS += $(OBJDIR)/file514.o
+SRCS += src/dir5/file515.cpp
+OBJS += $(OBJDIR)/file515.o
+SRCS += src/dir6/file516.cpp
+OBJS += $(OBJDIR)/file516.o
+SRCS += src/dir7/file517.cpp
+OBJS += $(OBJDIR)/file517.o
+SRCS += src/dir8/file518.cpp
+OBJS += $(OBJDIR)/file518.o
+SRCS += src/dir9/file519.cpp
+OBJS += $(OBJDIR)/file519.o
+SRCS += src/dir0/file520.cpp
+OBJS += $(OBJDIR)/file520.o
+SRCS += src/dir1/file521.cpp
+OBJS += $(OBJDIR)/file521.o
+SRCS += src/dir2/file522.cpp
+OBJS += $(OBJDIR)/file522.o
+SRCS += src/dir3/file523.cpp
+OBJS += $(OBJDIR)/file523.o
+SRCS += src/dir4/file524.cpp
+OBJS += $(OBJDIR)/file524.o
+SRCS += src/dir5/file525.cpp
+OBJS += $(OBJDIR)/file525.o
+SRCS += src/dir6/file526.cpp
+OBJS += $(OBJDIR)/file526.o
+SRCS += src/dir7/file527.cpp
+OBJS += $(OBJDIR)/file527.o
+SRCS += src/dir8/file528.cpp
+OBJS += $(OBJDIR)/file528.o
+SRCS += src/dir9/file529.cpp
+OBJS += $(OBJDIR)/file529.o
+SRCS += src/dir0/file530.cpp
+OBJS += $(OBJDIR)/file530.o
+SRCS += src/dir1/file531.cpp
+OBJS += $(OBJDIR)/file531.o
+SRCS += src/dir2/file532.cpp
+OBJS += $(OBJDIR)/file532.o
+SRCS += src/dir3/file533.cpp
+OBJS += $(OBJDIR)/file533.o
+SRCS += src/dir4/file534.cpp
+OBJS += $(OBJDIR)/file534.o
+SRCS += src/dir5/file535.cpp
+OBJS += $(OBJDIR)/file535.o
+SRCS += src/dir6/file536.cpp
+OBJS += $(OBJDIR)/file536.o
+SRCS += src/dir7/file537.cpp
+OBJS += $(OBJDIR)/file537.o
+SRCS += src/dir8/file538.cpp
+OBJS += $(OBJDIR)/file538.o
+SRCS += src/dir9/file539.cpp
+OBJS += $(OBJDIR)/file539.o
+SRCS += src/dir0/file540.cpp
+OBJS += $(OBJDIR)/file540.o
+SRCS += src/dir1/file541.cpp
+OBJS += $(OBJDIR)/file541.o
+SRCS += src/dir2/file542.cpp
+OBJS += $(OBJDIR)/file542.o
+SRCS += src/dir3/file543.cpp
+OBJS += $(OBJDIR)/file543.o
+SRCS += src/dir4/file544.cpp
+OBJS += $(OBJDIR)/file544.o
+SRCS += src/dir5/file545.cpp
+OBJS += $(OBJDIR)/file545.o
+SRCS += src/dir6/file546.cpp
+OBJS += $(OBJDIR)/file546.o
+SRCS += src/dir7/file547.cpp
+OBJS += $(OBJDIR)/file547.o
+SRCS += src/dir8/file548.cpp
+OBJS += $(OBJDIR)/file548.o
+SRCS += src/dir9/file549.cpp
+OBJS += $(OBJDIR)/file549.o
+SRCS += src/dir0/file550.cpp
+OBJS += $(OBJDIR)/file550.o
+SRCS += src/dir1/file551.cpp
+OBJS += $(OBJDIR)/file551.o
+SRCS += src/dir2/file552.cpp
+OBJS += $(OBJDIR)/file552.o
+SRCS += src/dir3/file553.cpp
+OBJS += $(OBJDIR)/file553.o
+SRCS += src/dir4/file554.cpp
+OBJS += $(OBJDIR)/file554.o
+SRCS += src/dir5/file555.cpp
+OBJS += $(OBJDIR)/file555.o
+SRCS += src/dir6/file556.cpp
+OBJS += $(OBJDIR)/file556.o
+SRCS += src/dir7/file557.cpp
+OBJS += $(OBJDIR)/file557.o
+SRCS += src/dir8/file558.cpp
+OBJS += $(OBJDIR)/file558.o
+SRCS += src/dir9/file559.cpp
+OBJS += $(OBJDIR)/file559.o
+SRCS += src/dir0/file560.cpp
+OBJS += $(OBJDIR)/file560.o
+SRCS += src/dir1/file561.cpp
+OBJS += $(OBJDIR)/file561.o
+SRCS += src/dir2/file562.cpp
+OBJS += $(OBJDIR)/file562.o
+SRCS += src/dir3/file563.cpp
+OBJS += $(OBJDIR)/file563.o
+SRCS += src/dir4/file564.cpp
+OBJS += $(OBJDIR)/file564.o
+SRCS += src/dir5/file565.cpp
+OBJS += $(OBJDIR)/file565.o
+SRCS += src/dir6/file566.cpp
+OBJS += $(OBJDIR)/file566.o
+SRCS += src/dir7/file567.cpp
+OBJS += $(OBJDIR)/file567.o
+SRCS += src/dir8/file568.cpp
+OBJS += $(OBJDIR)/file568.o
+SRCS += src/dir9/file569.cpp
+OBJS += $(OBJDIR)/file569.o
+SRCS += src/dir0/file570.cpp
+OBJS += $(OBJDIR)/file570.o
+SRCS += src/dir1/file571.cpp
+OBJS += $(OBJDIR)/file571.o
+SRCS += src/dir2/file572.cpp
+OBJS += $(OBJDIR)/file572.o
+SRCS += src/dir3/file573.cpp
+OBJS += $(OBJDIR)/file573.o
+SRCS += src/dir4/file574.cpp
+OBJS += $(OBJDIR)/file574.o
+SRCS += src/dir5/file575.cpp
+OBJS += $(OBJDIR)/file575.o
+SRCS += src/dir6/file576.cpp
+OBJS += $(OBJDIR)/file576.o
+SRCS += src/dir7/file577.cpp
+OBJS += $(OBJDIR)/file577.o
+SRCS += src/dir8/file578.cpp
+OBJS += $(OBJDIR)/file578.o
+SRCS += src/dir9/file579.cpp
+OBJS += $(OBJDIR)/file579.o
+SRCS += src/dir0/file580.cpp
+OBJS += $(OBJDIR)/file580.o
+SRCS += src/dir1/file581.cpp
+OBJS += $(OBJDIR)/file581.o
+SRCS += src/dir2/file582.cpp
+OBJS += $(OBJDIR)/file582.o
+SRCS += src/dir3/file583.cpp
+OBJS += $(OBJDIR)/file583.o
+SRCS += src/dir4/file584.cpp
+OBJS += $(OBJDIR)/file584.o
+SRCS += src/dir5/file585.cpp
+OBJS += $(OBJDIR)/file585.o
+SRCS += src/dir6/file586.cpp
+OBJS += $(OBJDIR)/file586.o
+SRCS += src/dir7/file587.cpp
+OBJS += $(OBJDIR)/file587.o
+SRCS += src/dir8/file588.cpp
+OBJS += $(OBJDIR)/file588.o
+SRCS += src/dir9/file589.cpp
+OBJS += $(OBJDIR)/file589.o
+SRCS += src/dir0/file590.cpp
+OBJS += $(OBJDIR)/file590.o
+SRCS += src/dir1/file591.cpp
+OBJS += $(OBJDIR)/file591.o
+SRCS += src/dir2/file592.cpp
+OBJS += $(OBJDIR)/file592.o
+SRCS += src/dir3/file593.cpp
+OBJS += $(OBJDIR)/file593.o
+SRCS += src/dir4/file594.cpp
+OBJS += $(OBJDIR)/file594.o
+SRCS += src/dir5/file595.cpp
+OBJS += $(OBJDIR)/file595.o
+SRCS += src/dir6/file596.cpp
+OBJS += $(OBJDIR)/file596.o
+SRCS += src/dir7/file597.cpp
+OBJS += $(OBJDIR)/file597.o
+SRCS += src/dir8/file598.cpp
+OBJS += $(OBJDIR)/file598.o
+SRCS += src/dir9/file599.cpp
+OBJS += $(OBJDIR)/file599.o
+SRCS += src/dir0/file600.cpp
+OBJS += $(OBJDIR)/file600.o
+SRCS += src/dir1/file601.cpp
+OBJS += $(OBJDIR)/file601.o
+SRCS += src/dir2/file602.cpp
+OBJS += $(OBJDIR)/file602.o
+SRCS += src/dir3/file603.cpp
+OBJS += $(OBJDIR)/file603.o
+SRCS += src/dir4/file604.cpp
+OBJS += $(OBJDIR)/file604.o
+SRCS += src/dir5/file605.cpp
+OBJS += $(OBJDIR)/file605.o
+SRCS += src/dir6/file606.cpp
+OBJS += $(OBJDIR)/file606.o
+SRCS += src/dir7/file607.cpp
+OBJS += $(OBJDIR)/file607.o
+SRCS += src/dir8/file608.cpp
+OBJS += $(OBJDIR)/file608.o
+SRCS += src/dir9/file609.cpp
+OBJS += $(OBJDIR)/file609.o
+SRCS += src/dir0/file610.cpp
+OBJS += $(OBJDIR)/file610.o
+SRCS += src/dir1/file611.cpp
+OBJS += $(OBJDIR)/file611.o
+SRCS += src/dir2/file612.cpp
+OBJS += $(OBJDIR)/file612.o
+SRCS += src/dir3/file613.cpp
+OBJS += $(OBJDIR)/file613.o
+SRCS += src/dir4/file614.cpp
+OBJS += $(OBJDIR)/file614.o
+SRCS += src/dir5/file615.cpp
+OBJS += $(OBJDIR)/file615.o
+SRCS += src/dir6/file616.cpp
+OBJS += $(OBJDIR)/file616.o
+SRCS += src/dir7/file617.cpp
+OBJS += $(OBJDIR)/file617.o
+SRCS += src/dir8/file618.cpp
+OBJS += $(OBJDIR)/file618.o
+SRCS += src/dir9/file619.cpp
+OBJS += $(OBJDIR)/file619.o
+SRCS += src/dir0/file620.cpp
+OBJS += $(OBJDIR)/file620.o
+SRCS += src/dir1/file621.cpp
+OBJS += $(OBJDIR)/file621.o
+SRCS += src/dir2/file622.cpp
+OBJS += $(OBJDIR)/file622.o
+SRCS += src/dir3/file623.cpp
+OBJS += $(OBJDIR)/file623.o
+SRCS += src/dir4/file624.cpp
+OBJS += $(OBJDIR)/file624.o
+SRCS += src/dir5/file625.cpp
+OBJS += $(OBJDIR)/file625.o
+SRCS += src/dir6/file626.cpp
+OBJS += $(OBJDIR)/file626.o
+SRCS += src/dir7/file627.cpp
+OBJS += $(OBJDIR)/file627.o
+SRCS += src/dir8/file628.cpp
+OBJS += $(OBJDIR)/file628.o
+SRCS += src/dir9/file629.cpp
+OBJS += $(OBJDIR)/file629.o
+SRCS += src/dir0/file630.cpp
+OBJS += $(OBJDIR)/file630.o
+SRCS += src/dir1/file631.cpp
+OBJS += $(OBJDIR)/file631.o
+SRCS += src/dir2/file632.cpp
+OBJS += $(OBJDIR)/file632.o
+SRCS += src/dir3/file633.cpp
+OBJS += $(OBJDIR)/file633.o
+SRCS += src/dir4/file634.cpp
+OBJS += $(OBJDIR)/file634.o
+SRCS += src/dir5/file635.cpp
+OBJS += $(OBJDIR)/file635.o
+SRCS += src/dir6/file636.cpp
+OBJS += $(OBJDIR)/file636.o
+SRCS += src/dir7/file637.cpp
+OBJS += $(OBJDIR)/file637.o
+SRCS += src/dir8/file638.cpp
+OBJS += $(OBJDIR)/file638.o
+SRCS += src/dir9/file639.cpp
+OBJS += $(OBJDIR)/file639.o
+SRCS += src/dir0/file640.cpp
+OBJS += $(OBJDIR)/file640.o
+SRCS += src/dir1/file641.cpp
+OBJS += $(OBJDIR)/file641.o
+SRCS += src/dir2/file642.cpp
+OBJS += $(OBJDIR)/file642.o
+SRCS += src/dir3/file643.cpp
+OBJS += $(OBJDIR)/file643.o
+SRCS += src/dir4/file644.cpp
+OBJS += $(OBJDIR)/file644.o
+SRCS += src/dir5/file645.cpp
+OBJS += $(OBJDIR)/file645.o
+SRCS += src/dir6/file646.cpp
+OBJS += $(OBJDIR)/file646.o
+SRCS += src/dir7/file647.cpp
+OBJS += $(OBJDIR)/file647.o
+SRCS += src/dir8/file648.cpp
+OBJS += $(OBJDIR)/file648.o
+SRCS += src/dir9/file649.cpp
+OBJS += $(OBJDIR)/file649.o
+SRCS += src/dir0/file650.cpp
+OBJS += $(OBJDIR)/file650.o
+SRCS += src/dir1/file651.cpp
+OBJS += $(OBJDIR)/file651.o
+SRCS += src/dir2/file652.cpp
+OBJS += $(OBJDIR)/file652.o
+SRCS += src/dir3/file653.cpp
+OBJS += $(OBJDIR)/file653.o
+SRCS += src/dir4/file654.cpp
+OBJS += $(OBJDIR)/file654.o
+SRCS += src/dir5/file655.cpp
+OBJS += $(OBJDIR)/file655.o
+SRCS += src/dir6/file656.cpp
+OBJS += $(OBJDIR)/file656.o
+SRCS += src/dir7/file657.cpp
+OBJS += $(OBJDIR)/file657.o
+SRCS += src/dir8/file658.cpp
+OBJS += $(OBJDIR)/file658.o
+SRCS += src/dir9/file659.cpp
+OBJS += $(OBJDIR)/file659.o
+SRCS += src/dir0/file660.cpp
+OBJS += $(OBJDIR)/file660.o
+SRCS += src/dir1/file661.cpp
+OBJS += $(OBJDIR)/file661.o
+SRCS += src/dir2/file662.cpp
+OBJS += $(OBJDIR)/file662.o
+SRCS += src/dir3/file663.cpp
+OBJS += $(OBJDIR)/file663.o
+SRCS += src/dir4/file664.cpp
+OBJS += $(OBJDIR)/file664.o
+SRCS += src/dir5/file665.cpp
+OBJS += $(OBJDIR)/file665.o
+SRCS += src/dir6/file666.cpp
+OBJS += $(OBJDIR)/file666.o
+SRCS += src/dir7/file667.cpp
+OBJS += $(OBJDIR)/file667.o
+SRCS += src/dir8/file668.cpp
+OBJS += $(OBJDIR)/file668.o
+SRCS += src/dir9/file669.cpp
+OBJS += $(OBJDIR)/file669.o
+SRCS += src/dir0/file670.cpp
+OBJS += $(OBJDIR)/file670.o
+SRCS += src/dir1/file671.cpp
+OBJS += $(OBJDIR)/file671.o
+SRCS += src/dir2/file672.cpp
+OBJS += $(OBJDIR)/file672.o
+SRCS += src/dir3/file673.cpp
+OBJS += $(OBJDIR)/file673.o
+SRCS += src/dir4/file674.cpp
+OBJS += $(OBJDIR)/file674.o
+SRCS += src/dir5/file675.cpp
+OBJS += $(OBJDIR)/file675.o
+SRCS += src/dir6/file676.cpp
+OBJS += $(OBJDIR)/file676.o
+SRCS += src/dir7/file677.cpp
+OBJS += $(OBJDIR)/file677.o
+SRCS += src/dir8/file678.cpp
+OBJS += $(OBJDIR)/file678.o
+SRCS += src/dir9/file679.cpp
+OBJS += $(OBJDIR)/file679.o
+SRCS += src/dir0/file680.cpp
+OBJS += $(OBJDIR)/file680.o
+SRCS += src/dir1/file681.cpp
+OBJS += $(OBJDIR)/file681.o
+SRCS += src/dir2/file682.cpp
+OBJS += $(OBJDIR)/file682.o
+SRCS += src/dir3/file683.cpp
+OBJS += $(OBJDIR)/file683.o
+SRCS += src/dir4/file684.cpp
+OBJS += $(OBJDIR)/file684.o
+SRCS += src/dir5/file685.cpp
+OBJS += $(OBJDIR)/file685.o
+SRCS += src/dir6/file686.cpp
+OBJS += $(OBJDIR)/file686.o
+SRCS += src/dir7/file687.cpp
+OBJS += $(OBJDIR)/file687.o
+SRCS += src/dir8/file688.cpp
+OBJS += $(OBJDIR)/file688.o
+SRCS += src/dir9/file689.cpp
+OBJS += $(OBJDIR)/file689.o
+SRCS += src/dir0/file690.cpp
+OBJS += $(OBJDIR)/file690.o
+SRCS += src/dir1/file691.cpp
+OBJS += $(OBJDIR)/file691.o
+SRCS += src/dir2/file692.cpp
+OBJS += $(OBJDIR)/file692.o
+SRCS += src/dir3/file693.cpp
+OBJS += $(OBJDIR)/file693.o
+SRCS += src/dir4/file694.cpp
+OBJS += $(OBJDIR)/file694.o
+SRCS += src/dir5/file695.cpp
+OBJS += $(OBJDIR)/file695.o
+SRCS += src/dir6/file696.cpp
+OBJS += $(OBJDIR)/file696.o
+SRCS += src/dir7/file697.cpp
+OBJS += $(OBJDIR)/file697.o
+SRCS += src/dir8/file698.cpp
+OBJS += $(OBJDIR)/file698.o
+SRCS += src/dir9/file699.cpp
+OBJS += $(OBJDIR)/file699.o
+SRCS += src/dir0/file700.cpp
+OBJS += $(OBJDIR)/file700.o
+SRCS += src/dir1/file701.cpp
+OBJS += $(OBJDIR)/file701.o
+SRCS += src/dir2/file702.cpp
+OBJS += $(OBJDIR)/file702.o
+SRCS += src/dir3/file703.cpp
+OBJS += $(OBJDIR)/file703.o
+SRCS += src/dir4/file704.cpp
+OBJS += $(OBJDIR)/file704.o
+SRCS += src/dir5/file705.cpp
+OBJS += $(OBJDIR)/file705.o
+SRCS += src/dir6/file706.cpp
+OBJS += $(OBJDIR)/file706.o
+SRCS += src/dir7/file707.cpp
+OBJS += $(OBJDIR)/file707.o
+SRCS += src/dir8/file708.cpp
+OBJS += $(OBJDIR)/file708.o
+SRCS += src/dir9/file709.cpp
+OBJS += $(OBJDIR)/file709.o
+SRCS += src/dir0/file710.cpp
+OBJS += $(OBJDIR)/file710.o
+SRCS += src/dir1/file711.cpp
+OBJS += $(OBJDIR)/file711.o
+SRCS += src/dir2/file712.cpp
+OBJS += $(OBJDIR)/file712.o
+SRCS += src/dir3/file713.cpp
+OBJS += $(OBJDIR)/file713.o
+SRCS += src/dir4/file714.cpp
+OBJS += $(OBJDIR)/file714.o
+SRCS += src/dir5/file715.cpp
+OBJS += $(OBJDIR)/file715.o
+SRCS += src/dir6/file716.cpp
+OBJS += $(OBJDIR)/file716.o
+SRCS += src/dir7/file717.cpp
+OBJS += $(OBJDIR)/file717.o
+SRCS += src/dir8/file718.cpp
+OBJS += $(OBJDIR)/file718.o
+SRCS += src/dir9/file719.cpp
+OBJS += $(OBJDIR)/file719.o
+SRCS += src/dir0/file720.cpp
+OBJS += $(OBJDIR)/file720.o
+SRCS += src/dir1/file721.cpp
+OBJS += $(OBJDIR)/file721.o
+SRCS += src/dir2/file722.cpp
+OBJS += $(OBJDIR)/file722.o
+SRCS += src/dir3/file723.cpp
+OBJS += $(OBJDIR)/file723.o
+SRCS += src/dir4/file724.cpp
+OBJS += $(OBJDIR)/file724.o
+SRCS += src/dir5/file725.cpp
+OBJS += $(OBJDIR)/file725.o
+SRCS += src/dir6/file726.cpp
+OBJS += $(OBJDIR)/file726.o
+SRCS += src/dir7/file727.cpp
+OBJS += $(OBJDIR)/file727.o
+SRCS += src/dir8/file728.cpp
+OBJS += $(OBJDIR)/file728.o
+SRCS += src/dir9/file729.cpp
+OBJS += $(OBJDIR)/file729.o
+SRCS += src/dir0/file730.cpp
+OBJS += $(OBJDIR)/file730.o
+SRCS += src/dir1/file731.cpp
+OBJS += $(OBJDIR)/file731.o
+SRCS += src/dir2/file732.cpp
+OBJS += $(OBJDIR)/file732.o
+SRCS += src/dir3/file733.cpp
+OBJS += $(OBJDIR)/file733.o
+SRCS += src/dir4/file734.cpp
+OBJS += $(OBJDIR)/file734.o
+SRCS += src/dir5/file735.cpp
+OBJS += $(OBJDIR)/file735.o
+SRCS += src/dir6/file736.cpp
+OBJS += $(OBJDIR)/file736.o
+SRCS += src/dir7/file737.cpp
+OBJS += $(OBJDIR)/file737.o
+SRCS += src/dir8/file738.cpp
+OBJS += $(OBJDIR)/file738.o
+SRCS += src/dir9/file739.cpp
+OBJS += $(OBJDIR)/file739.o
+SRCS += src/dir0/file740.cpp
+OBJS += $(OBJDIR)/file740.o
+SRCS += src/dir1/file741.cpp
+OBJS += $(OBJDIR)/file741.o
+SRCS += src/dir2/file742.cpp
+OBJS += $(OBJDIR)/file742.o
+SRCS += src/dir3/file743.cpp
+OBJS += $(OBJDIR)/file743.o
+SRCS += src/dir4/file744.cpp
+OBJS += $(OBJDIR)/file744.o
+SRCS += src/dir5/file745.cpp
+OBJS += $(OBJDIR)/file745.o
+SRCS += src/dir6/file746.cpp
+OBJS += $(OBJDIR)/file746.o
+SRCS += src/dir7/file747.cpp
+OBJS += $(OBJDIR)/file747.o
+SRCS += src/dir8/file748.cpp
+OBJS += $(OBJDIR)/file748.o
+SRCS += src/dir9/file749.cpp
+OBJS += $(OBJDIR)/file749.o
+SRCS += src/dir0/file750.cpp
+OBJS += $(OBJDIR)/file750.o
+SRCS += src/dir1/file751.cpp
+OBJS += $(OBJDIR)/file751.o
+SRCS += src/dir2/file752.cpp
+OBJS += $(OBJDIR)/file752.o
+SRCS += src/dir3/file753.cpp
+OBJS += $(OBJDIR)/file753.o
+SRCS += src/dir4/file754.cpp
+OBJS += $(OBJDIR)/file754.o
+SRCS += src/dir5/file755.cpp
+OBJS += $(OBJDIR)/file755.o
+SRCS += src/dir6/file756.cpp
+OBJS += $(OBJDIR)/file756.o
+SRCS += src/dir7/file757.cpp
+OBJS += $(OBJDIR)/file757.o
+SRCS += src/dir8/file758.cpp
+OBJS += $(OBJDIR)/file758.o
+SRCS += src/dir9/file759.cpp
+OBJS += $(OBJDIR)/file759.o
+SRCS += src/dir0/file760.cpp
+OBJS += $(OBJDIR)/file760.o
+SRCS += src/dir1/file761.cpp
+OBJS += $(OBJDIR)/file761.o
+SRCS += src/dir2/file762.cpp
+OBJS += $(OBJDIR)/file762.o
+SRCS += src/dir3/file763.cpp
+OBJS += $(OBJDIR)/file763.o
+SRCS += src/dir4/file764.cpp
+OBJS += $(OBJDIR)/file764.o
+SRCS += src/dir5/file765.cpp
+OBJS += $(OBJDIR)/file765.o
+SRCS += src/dir6/file766.cpp
+OBJS += $(OBJDIR)/file766.o
+SRCS += src/dir7/file767.cpp
+OBJS += $(OBJDIR)/file767.o
+SRCS += src/dir8/file768.cpp
+OBJS += $(OBJDIR)/file768.o
+SRCS += src/dir9/file769.cpp
+OBJS += $(OBJDIR)/file769.o
+SRCS += src/dir0/file770.cpp
+OBJS += $(OBJDIR)/file770.o
+SRCS += src/dir1/file771.cpp
+OBJS += $(OBJDIR)/file771.o
+SRCS += src/dir2/file772.cpp
+OBJS += $(OBJDIR)/file772.o
+SRCS += src/dir3/file773.cpp
+OBJS += $(OBJDIR)/file773.o
+SRCS += src/dir4/file774.cpp
+OBJS += $(OBJDIR)/file774.o
+SRCS += src/dir5/file775.cpp
+OBJS += $(OBJDIR)/file775.o
+SRCS += src/dir6/file776.cpp
+OBJS += $(OBJDIR)/file776.o
+SRCS += src/dir7/file777.cpp
+OBJS += $(OBJDIR)/file777.o
+SRCS += src/dir8/file778.cpp
+OBJS += $(OBJDIR)/file778.o
+SRCS += src/dir9/file779.cpp
+OBJS += $(OBJDIR)/file779.o
+SRCS += src/dir0/file780.cpp
+OBJS += $(OBJDIR)/file780.o
+SRCS += src/dir1/file781.cpp
+OBJS += $(OBJDIR)/file781.o
+SRCS += src/dir2/file782.cpp
+OBJS += $(OBJDIR)/file782.o
+SRCS += src/dir3/file783.cpp
+OBJS += $(OBJDIR)/file783.o
+SRCS += src/dir4/file784.cpp
+OBJS += $(OBJDIR)/file784.o
+SRCS += src/dir5/file785.cpp
+OBJS += $(OBJDIR)/file785.o
+SRCS += src/dir6/file786.cpp
+OBJS += $(OBJDIR)/file786.o
+SRCS += src/dir7/file787.cpp
+OBJS += $(OBJDIR)/file787.o
+SRCS += src/dir8/file788.cpp
+OBJS += $(OBJDIR)/file788.o
+SRCS += src/dir9/file789.cpp
+OBJS += $(OBJDIR)/file789.o
+SRCS += src/dir0/file790.cpp
+OBJS += $(OBJDIR)/file790.o
+SRCS += src/dir1/file791.cpp
+OBJS += $(OBJDIR)/file791.o
+SRCS += src/dir2/file792.cpp
+OBJS += $(OBJDIR)/file792.o
+SRCS += src/dir3/file793.cpp
+OBJS += $(OBJDIR)/file793.o
+SRCS += src/dir4/file794.cpp
+OBJS += $(OBJDIR)/file794.o
+SRCS += src/dir5/file795.cpp
+OBJS += $(OBJDIR)/file795.o
+SRCS += src/dir6/file796.cpp
+OBJS += $(OBJDIR)/file796.o
+SRCS += src/dir7/file797.cpp
+OBJS += $(OBJDIR)/file797.o
+SRCS += src/dir8/file798.cpp
+OBJS += $(OBJDIR)/file798.o
+SRCS += src/dir9/file799.cpp
+OBJS += $(OBJDIR)/file799.o
+SRCS += src/dir0/file800.cpp
+OBJS += $(OBJDIR)/file800.o
+SRCS += src/dir1/file801.cpp
+OBJS += $(OBJDIR)/file801.o
+SRCS += src/dir2/file802.cpp
+OBJS += $(OBJDIR)/file802.o
+SRCS += src/dir3/file803.cpp
+OBJS += $(OBJDIR)/file803.o
+SRCS += src/dir4/file804.cpp
+OBJS += $(OBJDIR)/file804.o
+SRCS += src/dir5/file805.cpp
+OBJS += $(OBJDIR)/file805.o
+SRCS += src/dir6/file806.cpp
+OBJS += $(OBJDIR)/file806.o
+SRCS += src/dir7/file807.cpp
+OBJS += $(OBJDIR)/file807.o
+SRCS += src/dir8/file808.cpp
+OBJS += $(OBJDIR)/file808.o
+SRCS += src/dir9/file809.cpp
+OBJS += $(OBJDIR)/file809.o
+SRCS += src/dir0/file810.cpp
+OBJS += $(OBJDIR)/file810.o
+SRCS += src/dir1/file811.cpp
+OBJS += $(OBJDIR)/file811.o
+SRCS += src/dir2/file812.cpp
+OBJS += $(OBJDIR)/file812.o
+SRCS += src/dir3/file813.cpp
+OBJS += $(OBJDIR)/file813.o
+SRCS += src/dir4/file814.cpp
+OBJS += $(OBJDIR)/file814.o
+SRCS += src/dir5/file815.cpp
+OBJS += $(OBJDIR)/file815.o
+SRCS += src/dir6/file816.cpp
+OBJS += $(OBJDIR)/file816.o
+SRCS += src/dir7/file817.cpp
+OBJS += $(OBJDIR)/file817.o
+SRCS += src/dir8/file818.cpp
+OBJS += $(OBJDIR)/file818.o
+SRCS += src/dir9/file819.cpp
+OBJS += $(OBJDIR)/file819.o
+SRCS += src/dir0/file820.cpp
+OBJS += $(OBJDIR)/file820.o
+SRCS += src/dir1/file821.cpp
+OBJS += $(OBJDIR)/file821.o
+SRCS += src/dir2/file822.cpp
+OBJS += $(OBJDIR)/file822.o
+SRCS += src/dir3/file823.cpp
+OBJS += $(OBJDIR)/file823.o
+SRCS += src/dir4/file824.cpp
+OBJS += $(OBJDIR)/file824.o
+SRCS += src/dir5/file825.cpp
+OBJS += $(OBJDIR)/file825.o
+SRCS += src/dir6/file826.cpp
+OBJS += $(OBJDIR)/file826.o
+SRCS += src/dir7/file827.cpp
+OBJS += $(OBJDIR)/file827.o
+SRCS += src/dir8/file828.cpp
+OBJS += $(OBJDIR)/file828.o
+SRCS += src/dir9/file829.cpp
+OBJS += $(OBJDIR)/file829.o
+SRCS += src/dir0/file830.cpp
+OBJS += $(OBJDIR)/file830.o
+SRCS += src/dir1/file831.cpp
+OBJS += $(OBJDIR)/file831.o
+SRCS += src/dir2/file832.cpp
+OBJS += $(OBJDIR)/file832.o
+SRCS += src/dir3/file833.cpp
+OBJS += $(OBJDIR)/file833.o
+SRCS += src/dir4/file834.cpp
+OBJS += $(OBJDIR)/file834.o
+SRCS += src/dir5/file835.cpp
+OBJS += $(OBJDIR)/file835.o
+SRCS += src/dir6/file836.cpp
+OBJS += $(OBJDIR)/file836.o
+SRCS += src/dir7/file837.cpp
+OBJS += $(OBJDIR)/file837.o
+SRCS += src/dir8/file838.cpp
+OBJS += $(OBJDIR)/file838.o
+SRCS += src/dir9/file839.cpp
+OBJS += $(OBJDIR)/file839.o
+SRCS += src/dir0/file840.cpp
+OBJS += $(OBJDIR)/file840.o
+SRCS += src/dir1/file841.cpp
+OBJS += $(OBJDIR)/file841.o
+SRCS += src/dir2/file842.cpp
+OBJS += $(OBJDIR)/file842.o
+SRCS += src/dir3/file843.cpp
+OBJS += $(OBJDIR)/file843.o
+SRCS += src/dir4/file844.cpp
+OBJS += $(OBJDIR)/file844.o
+SRCS += src/dir5/file845.cpp
+OBJS += $(OBJDIR)/file845.o
+SRCS += src/dir6/file846.cpp
+OBJS += $(OBJDIR)/file846.o
+SRCS += src/dir7/file847.cpp
+OBJS += $(OBJDIR)/file847.o
+SRCS += src/dir8/file848.cpp
+OBJS += $(OBJDIR)/file848.o
+SRCS += src/dir9/file849.cpp
+OBJS += $(OBJDIR)/file849.o
+SRCS += src/dir0/file850.cpp
+OBJS += $(OBJDIR)/file850.o
+SRCS += src/dir1/file851.cpp
+OBJS += $(OBJDIR)/file851.o
+SRCS += src/dir2/file852.cpp
+OBJS += $(OBJDIR)/file852.o
+SRCS += src/dir3/file853.cpp
+OBJS += $(OBJDIR)/file853.o
+SRCS += src/dir4/file854.cpp
+OBJS += $(OBJDIR)/file854.o
+SRCS += src/dir5/file855.cpp
+OBJS += $(OBJDIR)/file855.o
+SRCS += src/dir6/file856.cpp
+OBJS += $(OBJDIR)/file856.o
+SRCS += src/dir7/file857.cpp
+OBJS += $(OBJDIR)/file857.o
+SRCS += src/dir8/file858.cpp
+OBJS += $(OBJDIR)/file858.o
+SRCS += src/dir9/file859.cpp
+OBJS += $(OBJDIR)/file859.o
+SRCS += src/dir0/file860.cpp
+OBJS += $(OBJDIR)/file860.o
+SRCS += src/dir1/file861.cpp
+OBJS += $(OBJDIR)/file861.o
+SRCS += src/dir2/file862.cpp
+OBJS += $(OBJDIR)/file862.o
+SRCS += src/dir3/file863.cpp
+OBJS += $(OBJDIR)/file863.o
+SRCS += src/dir4/file864.cpp
+OBJS += $(OBJDIR)/file864.o
+SRCS += src/dir5/file865.cpp
+OBJS += $(OBJDIR)/file865.o
+SRCS += src/dir6/file866.cpp
+OBJS += $(OBJDIR)/file866.o
+SRCS += src/dir7/file867.cpp
+OBJS += $(OBJDIR)/file867.o
+SRCS += src/dir8/file868.cpp
+OBJS += $(OBJDIR)/file868.o
+SRCS += src/dir9/file869.cpp
+OBJS += $(OBJDIR)/file869.o
+SRCS += src/dir0/file870.cpp
+OBJS += $(OBJDIR)/file870.o
+SRCS += src/dir1/file871.cpp
+OBJS += $(OBJDIR)/file871.o
+SRCS += src/dir2/file872.cpp
+OBJS += $(OBJDIR)/file872.o
+SRCS += src/dir3/file873.cpp
+OBJS += $(OBJDIR)/file873.o
+SRCS += src/dir4/file874.cpp
+OBJS += $(OBJDIR)/file874.o
+SRCS += src/dir5/file875.cpp
+OBJS += $(OBJDIR)/file875.o
+SRCS += src/dir6/file876.cpp
+OBJS += $(OBJDIR)/file876.o
+SRCS += src/dir7/file877.cpp
+OBJS += $(OBJDIR)/file877.o
+SRCS += src/dir8/file878.cpp
+OBJS += $(OBJDIR)/file878.o
+SRCS += src/dir9/file879.cpp
+OBJS += $(OBJDIR)/file879.o
+SRCS += src/dir0/file880.cpp
+OBJS += $(OBJDIR)/file880.o
+SRCS += src/dir1/file881.cpp
+OBJS += $(OBJDIR)/file881.o
+SRCS += src/dir2/file882.cpp
+OBJS += $(OBJDIR)/file882.o
+SRCS += src/dir3/file883.cpp
+OBJS += $(OBJDIR)/file883.o
+SRCS += src/dir4/file884.cpp
+OBJS += $(OBJDIR)/file884.o
+SRCS += src/dir5/file885.cpp
+OBJS += $(OBJDIR)/file885.o
+SRCS += src/dir6/file886.cpp
+OBJS += $(OBJDIR)/file886.o
+SRCS += src/dir7/file887.cpp
+OBJS += $(OBJDIR)/file887.o
+SRCS += src/dir8/file888.cpp
+OBJS += $(OBJDIR)/file888.o
+SRCS += src/dir9/file889.cpp
+OBJS += $(OBJDIR)/file889.o
+SRCS += src/dir0/file890.cpp
+OBJS += $(OBJDIR)/file890.o
+SRCS += src/dir1/file891.cpp
+OBJS += $(OBJDIR)/file891.o
+SRCS += src/dir2/file892.cpp
+OBJS += $(OBJDIR)/file892.o
+SRCS += src/dir3/file893.cpp
+OBJS += $(OBJDIR)/file893.o
+SRCS += src/dir4/file894.cpp
+OBJS += $(OBJDIR)/file894.o
+SRCS += src/dir5/file895.cpp
+OBJS += $(OBJDIR)/file895.o
+SRCS += src/dir6/file896.cpp
+OBJS += $(OBJDIR)/file896.o
+SRCS += src/dir7/file897.cpp
+OBJS += $(OBJDIR)/file897.o
+SRCS += src/dir8/file898.cpp
+OBJS += $(OBJDIR)/file898.o
+SRCS += src/dir9/file899.cpp
+OBJS += $(OBJDIR)/file899.o
+SRCS += src/dir0/file900.cpp
+OBJS += $(OBJDIR)/file900.o
+SRCS += src/dir1/file901.cpp
+OBJS += $(OBJDIR)/file901.o
+SRCS += src/dir2/file902.cpp
+OBJS += $(OBJDIR)/file902.o
+SRCS += src/dir3/file903.cpp
+OBJS += $(OBJDIR)/file903.o
+SRCS += src/dir4/file904.cpp
+OBJS += $(OBJDIR)/file904.o
+SRCS += src/dir5/file905.cpp
+OBJS += $(OBJDIR)/file905.o
+SRCS += src/dir6/file906.cpp
+OBJS += $(OBJDIR)/file906.o
+SRCS += src/dir7/file907.cpp
+OBJS += $(OBJDIR)/file907.o
+SRCS += src/dir8/file908.cpp
+OBJS += $(OBJDIR)/file908.o
+SRCS += src/dir9/file909.cpp
+OBJS += $(OBJDIR)/file909.o
+SRCS += src/dir0/file910.cpp
+OBJS += $(OBJDIR)/file910.o
+SRCS += src/dir1/file911.cpp
+OBJS += $(OBJDIR)/file911.o
+SRCS += src/dir2/file912.cpp
+OBJS += $(OBJDIR)/file912.o
+SRCS += src/dir3/file913.cpp
+OBJS += $(OBJDIR)/file913.o
+SRCS += src/dir4/file914.cpp
+OBJS += $(OBJDIR)/file914.o
+SRCS += src/dir5/file915.cpp
+OBJS += $(OBJDIR)/file915.o
+SRCS += src/dir6/file916.cpp
+OBJS += $(OBJDIR)/file916.o
+SRCS += src/dir7/file917.cpp
+OBJS += $(OBJDIR)/file917.o
+SRCS += src/dir8/file918.cpp
+OBJS += $(OBJDIR)/file918.o
+SRCS += src/dir9/file919.cpp
+OBJS += $(OBJDIR)/file919.o
+SRCS += src/dir0/file920.cpp
+OBJS += $(OBJDIR)/file920.o
+SRCS += src/dir1/file921.cpp
+OBJS += $(OBJDIR)/file921.o
+SRCS += src/dir2/file922.cpp
+OBJS += $(OBJDIR)/file922.o
+SRCS += src/dir3/file923.cpp
+OBJS += $(OBJDIR)/file923.o
+SRCS += src/dir4/file924.cpp
+OBJS += $(OBJDIR)/file924.o
+SRCS += src/dir5/file925.cpp
+OBJS += $(OBJDIR)/file925.o
+SRCS += src/dir6/file926.cpp
+OBJS += $(OBJDIR)/file926.o
+SRCS += src/dir7/file927.cpp
+OBJS += $(OBJDIR)/file927.o
+SRCS += src/dir8/file928.cpp
+OBJS += $(OBJDIR)/file928.o
+SRCS += src/dir9/file929.cpp
+OBJS += $(OBJDIR)/file929.o
+SRCS += src/dir0/file930.cpp
+OBJS += $(OBJDIR)/file930.o
+SRCS += src/dir1/file931.cpp
+OBJS += $(OBJDIR)/file931.o
+SRCS += src/dir2/file932.cpp
+OBJS += $(OBJDIR)/file932.o
+SRCS += src/dir3/file933.cpp
+OBJS += $(OBJDIR)/file933.o
+SRCS += src/dir4/file934.cpp
+OBJS += $(OBJDIR)/file934.o
+SRCS += src/dir5/file935.cpp
+OBJS += $(OBJDIR)/file935.o
+SRCS += src/dir6/file936.cpp
+OBJS += $(OBJDIR)/file936.o
+SRCS += src/dir7/file937.cpp
+OBJS += $(OBJDIR)/file937.o
+SRCS += src/dir8/file938.cpp
+OBJS += $(OBJDIR)/file938.o
+SRCS += src/dir9/file939.cpp
+OBJS += $(OBJDIR)/file939.o
+SRCS += src/dir0/file940.cpp
+OBJS += $(OBJDIR)/file940.o
+SRCS += src/dir1/file941.cpp
+OBJS += $(OBJDIR)/file941.o
+SRCS += src/dir2/file942.cpp
+OBJS += $(OBJDIR)/file942.o
+SRCS += src/dir3/file943.cpp
+OBJS += $(OBJDIR)/file943.o
+SRCS += src/dir4/file944.cpp
+OBJS += $(OBJDIR)/file944.o
+SRCS += src/dir5/file945.cpp
+OBJS += $(OBJDIR)/file945.o
+SRCS += src/dir6/file946.cpp
+OBJS += $(OBJDIR)/file946.o
+SRCS += src/dir7/file947.cpp
+OBJS += $(OBJDIR)/file947.o
+SRCS += src/dir8/file948.cpp
+OBJS += $(OBJDIR)/file948.o
+SRCS += src/dir9/file949.cpp
+OBJS += $(OBJDIR)/file949.o
+SRCS += src/dir0/file950.cpp
+OBJS += $(OBJDIR)/file950.o
+SRCS += src/dir1/file951.cpp
+OBJS += $(OBJDIR)/file951.o
+SRCS += src/dir2/file952.cpp
+OBJS += $(OBJDIR)/file952.o
+SRCS += src/dir3/file953.cpp
+OBJS += $(OBJDIR)/file953.o
+SRCS += src/dir4/file954.cpp
+OBJS += $(OBJDIR)/file954.o
+SRCS += src/dir5/file955.cpp
+OBJS += $(OBJDIR)/file955.o
+SRCS += src/dir6/file956.cpp
+OBJS += $(OBJDIR)/file956.o
+SRCS += src/dir7/file957.cpp
+OBJS += $(OBJDIR)/file957.o
+SRCS += src/dir8/file958.cpp
+OBJS += $(OBJDIR)/file958.o
+SRCS += src/dir9/file959.cpp
+OBJS += $(OBJDIR)/file959.o
+SRCS += src/dir0/file960.cpp
+OBJS += $(OBJDIR)/file960.o
+SRCS += src/dir1/file961.cpp
+OBJS += $(OBJDIR)/file961.o
+SRCS += src/dir2/file962.cpp
+OBJS += $(OBJDIR)/file962.o
+SRCS += src/dir3/file963.cpp
+OBJS += $(OBJDIR)/file963.o
+SRCS += src/dir4/file964.cpp
+OBJS += $(OBJDIR)/file964.o
+SRCS += src/dir5/file965.cpp
+OBJS += $(OBJDIR)/file965.o
+SRCS += src/dir6/file966.cpp
+OBJS += $(OBJDIR)/file966.o
+SRCS += src/dir7/file967.cpp
+OBJS += $(OBJDIR)/file967.o
+SRCS += src/dir8/file968.cpp
+OBJS += $(OBJDIR)/file968.o
+SRCS += src/dir9/file969.cpp
+OBJS += $(OBJDIR)/file969.o
+SRCS += src/dir0/file970.cpp
+OBJS += $(OBJDIR)/file970.o
+SRCS += src/dir1/file971.cpp
+OBJS += $(OBJDIR)/file971.o
+SRCS += src/dir2/file972.cpp
+OBJS += $(OBJDIR)/file972.o
+SRCS += src/dir3/file973.cpp
+OBJS += $(OBJDIR)/file973.o
+SRCS += src/dir4/file974.cpp
+OBJS += $(OBJDIR)/file974.o
+SRCS += src/dir5/file975.cpp
+OBJS += $(OBJDIR)/file975.o
+SRCS += src/dir6/file976.cpp
+OBJS += $(OBJDIR)/file976.o
+SRCS += src/dir7/file977.cpp
+OBJS += $(OBJDIR)/file977.o
+SRCS += src/dir8/file978.cpp
+OBJS += $(OBJDIR)/file978.o
+SRCS += src/dir9/file979.cpp
+OBJS += $(OBJDIR)/file979.o
+SRCS += src/dir0/file980.cpp
+OBJS += $(OBJDIR)/file980.o
+SRCS += src/dir1/file981.cpp
+OBJS += $(OBJDIR)/file981.o
+SRCS += src/dir2/file982.cpp
+OBJS += $(OBJDIR)/file982.o
+SRCS += src/dir3/file983.cpp
+OBJS += $(OBJDIR)/file983.o
+SRCS += src/dir4/file984.cpp
+OBJS += $(OBJDIR)/file984.o
+SRCS += src/dir5/file985.cpp
+OBJS += $(OBJDIR)/file985.o
+SRCS += src/dir6/file986.cpp
+OBJS += $(OBJDIR)/file986.o
+SRCS += src/dir7/file987.cpp
+OBJS += $(OBJDIR)/file987.o
+SRCS += src/dir8/file988.cpp
+OBJS += $(OBJDIR)/file988.o
+SRCS += src/dir9/file989.cpp
+OBJS += $(OBJDIR)/file989.o
+SRCS += src/dir0/file990.cpp
+OBJS += $(OBJDIR)/file990.o
+SRCS += src/dir1/file991.cpp
+OBJS += $(OBJDIR)/file991.o
+SRCS += src/dir2/file992.cpp
+OBJS += $(OBJDIR)/file992.o
+SRCS += src/dir3/file993.cpp
+OBJS += $(OBJDIR)/file993.o
+SRCS += src/dir4/file994.cpp
+OBJS += $(OBJDIR)/file994.o
+SRCS += src/dir5/file995.cpp
+OBJS += $(OBJDIR)/file995.o
+SRCS += src/dir6/file996.cpp
+OBJS += $(OBJDIR)/file996.o
+SRCS += src/dir7/file997.cpp
+OBJS += $(OBJDIR)/file997.o
+SRCS += src/dir8/file998.cpp
+OBJS += $(OBJDIR)/file998.o
+SRCS += src/dir9/file999.cpp
+OBJS += $(OBJDIR)/file999.o
+SRCS += src/dir0/file1000.cpp
+OBJS += $(OBJDIR)/file1000.o
+
+OBJDIR = obj
+
+append:
+	@echo $(words $(SRCS)) $(words $(OBJS)) $(lastword $(OBJS))
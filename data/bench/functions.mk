@@ -0,0 +1,28 @@
+# Text function benchmark: 20k words through foreach, filter, patsubst, sort
+#
+#  time CMake -f functions.mk functions
+#
+
+W0 := a.cpp b.cpp c.h d.cpp e.h
+W1 := $(W0) $(W0)
+W2 := $(W1) $(W1)
+W3 := $(W2) $(W2)
+W4 := $(W3) $(W3)
+W5 := $(W4) $(W4)
+W6 := $(W5) $(W5)
+W7 := $(W6) $(W6)
+W8 := $(W7) $(W7)
+W9 := $(W8) $(W8)
+W10 := $(W9) $(W9)
+W11 := $(W10) $(W10)
+W12 := $(foreach n,1 2,$(addprefix $(n)/,$(W11)))
+
+SRCS := $(filter %.cpp,$(W12))
+HDRS := $(filter-out %.cpp,$(W12))
+OBJS := $(patsubst %.cpp,obj/%.o,$(SRCS))
+DEPS := $(OBJS:.o=.d)
+DIRS := $(sort $(dir $(OBJS)))
+NAMES := $(sort $(notdir $(basename $(W12))))
+
+functions:
+	@echo $(words $(W12)) $(words $(OBJS)) $(words $(DEPS)) $(words $(HDRS)) $(DIRS) $(NAMES)
@@ -0,0 +1,13 @@
+# Tokenizer benchmark: rule with 10,000 prerequisites
+#
+#  time CMake -f words.mk words
+#
+W1 = a.o b.o c.o d.o e.o f.o g.o h.o i.o j.o
+
+W10    := $(W1) $(W1) $(W1) $(W1) $(W1) $(W1) $(W1) $(W1) $(W1) $(W1)
+W100   := $(W10) $(W10) $(W10) $(W10) $(W10) $(W10) $(W10) $(W10) $(W10) $(W10)
+W1000  := $(W100) $(W100) $(W100) $(W100) $(W100) $(W100) $(W100) $(W100) $(W100) $(W100)
+W10000 := $(W1000) $(W1000) $(W1000) $(W1000) $(W1000) $(W1000) $(W1000) $(W1000) $(W1000) $(W1000)
+
+words: $(W10000)
+	@echo "words"
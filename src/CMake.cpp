@@ -2,21 +2,55 @@
 #include <CFileParse.h>
 #include <CFile.h>
 #include <CStrParse.h>
-#include <COSProcess.h>
 #include <iostream>
+#include <deque>
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <fstream>
+#include <cstdio>
+#include <string_view>
+#include <cstring>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fnmatch.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <cerrno>
+#include <sys/ioctl.h>
+#include <sys/file.h>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+
+extern char **environ;
+
+static int64_t CMakeStatTime(const struct stat &sb);
 
 int
 main(int argc, char **argv)
 {
   CMake make;
 
-  using Rules = std::vector<std::string>;
-  using Vars  = std::vector<std::string>;
+  using Rules   = std::vector<std::string>;
+  using Vars    = std::vector<std::string>;
+  using CmdVars = std::vector<std::pair<std::string,std::string>>;
 
   std::string filename;
   std::string includeDir;
   Rules       rules;
   Vars        printVars;
+  CmdVars     cmdVars;
+  std::string artifactDir;
+  uint64_t    artifactSize  = 2048;
+  bool        artifactLink  = false;
+  bool        artifactStats = false;
+  bool        buildDb     = false;
+  bool        parseCache  = false;
   bool        processArgs = true;
 
   for (int i = 1; i < argc; ++i) {
@@ -35,6 +69,53 @@ main(int argc, char **argv)
         if (i < argc)
           includeDir = argv[i];
       }
+      else if (opt == "j" || opt == "-jobs") {
+        // -j N, --jobs N (-j with no number uses all cores)
+        if (i + 1 < argc && isdigit(argv[i + 1][0])) {
+          ++i;
+
+          make.setNumJobs(atoi(argv[i]));
+        }
+        else
+          make.setNumJobs(int(std::thread::hardware_concurrency()));
+      }
+      else if (opt[0] == 'j' && isdigit(opt[1])) {
+        // -jN
+        make.setNumJobs(atoi(&opt[1]));
+      }
+      else if (opt.substr(0, 6) == "-jobs=") {
+        // --jobs=N
+        make.setNumJobs(atoi(&opt[6]));
+      }
+      else if (opt == "k" || opt == "-keep-going")
+        make.setKeepGoing(true);
+      else if (opt == "db" || opt == "-build-db")
+        buildDb = true;
+      else if (opt == "cache" || opt == "-parse-cache")
+        parseCache = true;
+      else if (opt == "artifact-cache" || opt == "-artifact-cache") {
+        ++i;
+
+        if (i < argc)
+          artifactDir = argv[i];
+      }
+      else if (opt == "artifact-cache-size" || opt == "-artifact-cache-size") {
+        // size in MB
+        ++i;
+
+        if (i < argc)
+          artifactSize = strtoull(argv[i], nullptr, 10);
+      }
+      else if (opt == "artifact-cache-link" || opt == "-artifact-cache-link")
+        artifactLink = true;
+      else if (opt == "artifact-stats" || opt == "-artifact-stats")
+        artifactStats = true;
+      else if (opt == "hash" || opt == "-content-hash") {
+        // input hashes are stored in build database
+        make.setContentHash(true);
+
+        buildDb = true;
+      }
       else if (opt == "quiet")
         make.setQuiet(true);
       else if (opt == "debug")
@@ -52,11 +133,22 @@ main(int argc, char **argv)
         std::cerr << "Invalid option '-" << opt << "'\n";
       }
     }
+    else if (strchr(argv[i], '=')) {
+      // NAME=value
+      std::string arg = argv[i];
+
+      auto pos = arg.find('=');
+
+      cmdVars.emplace_back(arg.substr(0, pos), arg.substr(pos + 1));
+    }
     else {
       rules.push_back(argv[i]);
     }
   }
 
+  for (const auto &var : cmdVars)
+    make.setCommandLineVariable(var.first, var.second);
+
   if (filename == "") {
     std::vector<std::string> filenames {"makefile", "Makefile"};
 
@@ -68,23 +160,69 @@ main(int argc, char **argv)
     }
   }
 
-  make.processFile(filename);
+  // build database and parse cache are stored next to the makefile
+  auto pos = filename.rfind('/');
+
+  std::string dir = (pos != std::string::npos ? filename.substr(0, pos + 1) : "");
+
+  // parse cache does not record command line variables
+  if (parseCache && cmdVars.empty()) {
+    auto cacheFile = dir + ".cmake_cache";
+
+    if (! make.loadParseCache(cacheFile, filename)) {
+      make.processFile(filename);
+
+      make.saveParseCache(cacheFile, filename);
+    }
+  }
+  else
+    make.processFile(filename);
+
+  if (buildDb)
+    make.loadBuildDb(dir + ".cmake_db");
+
+  make.setIncludeCacheFile(dir + ".cmake_includes");
+
+  if (! artifactDir.empty())
+    make.setArtifactCache(artifactDir, artifactSize*1024*1024, artifactLink);
 
   if (! printVars.empty()) {
     for (const auto &var : printVars) {
       CMake::Variable *var1 = make.getVariable(var);
 
+      if (! var1) {
+        std::cerr << "Undefined variable '" << var << "'\n";
+        continue;
+      }
+
       std::cout << var1->name << "=" << var1->value << "\n";
     }
   }
 
+  bool rc = true;
+
   if (! rules.empty()) {
-    for (const auto &rule : rules)
-      make.make(rule);
+    for (const auto &rule : rules) {
+      if (! make.make(rule)) {
+        rc = false;
+
+        if (! make.isKeepGoing())
+          break;
+      }
+    }
   }
 
   if (printVars.empty() && rules.empty())
-    make.make();
+    rc = make.make();
+
+  if (make.isBuildDb())
+    make.saveBuildDb();
+
+  make.saveIncludeCache();
+
+  make.saveArtifactStats(artifactStats);
+
+  return (rc ? 0 : 1);
 }
 
 //---
@@ -92,6 +230,210 @@ main(int argc, char **argv)
 CMake::
 CMake()
 {
+  // default suffix list for suffix rules
+  suffixes_ = {{
+    ".out", ".a", ".ln", ".o", ".c", ".cc", ".C", ".cpp", ".p", ".f", ".F", ".m", ".r",
+    ".y", ".l", ".ym", ".yl", ".s", ".S", ".mod", ".sym", ".def", ".h", ".info", ".dvi",
+    ".tex", ".texinfo", ".texi", ".txinfo", ".w", ".ch", ".web", ".sh", ".elc", ".el" }};
+}
+
+//---
+
+// Reads a makefile into memory in one go (mmap or a single block read) and
+// returns its lines as views into the buffer. Only lines with backslash
+// continuations are copied (into a scratch buffer) to remove the
+// backslash newline pairs.
+class CMakeLineReader {
+ public:
+  CMakeLineReader() { }
+
+ ~CMakeLineReader() {
+    if (mapped_)
+      ::munmap(const_cast<char *>(data_), size_);
+  }
+
+  CMakeLineReader(const CMakeLineReader &) = delete;
+  CMakeLineReader &operator=(const CMakeLineReader &) = delete;
+
+  bool open(const std::string &filename) {
+    int fd = ::open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+      return false;
+
+    struct stat sb;
+
+    if (::fstat(fd, &sb) != 0) {
+      ::close(fd);
+      return false;
+    }
+
+    size_ = size_t(sb.st_size);
+
+    if (size_ > 0) {
+      void *addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (addr != MAP_FAILED) {
+        data_   = static_cast<const char *>(addr);
+        mapped_ = true;
+      }
+      else {
+        // fallback to block read
+        buffer_.resize(size_);
+
+        size_t pos = 0;
+
+        while (pos < size_) {
+          auto n = ::read(fd, &buffer_[pos], size_ - pos);
+
+          if (n <= 0)
+            break;
+
+          pos += size_t(n);
+        }
+
+        size_ = pos;
+        data_ = buffer_.data();
+      }
+    }
+
+    ::close(fd);
+
+    return true;
+  }
+
+  bool nextLine(std::string_view &line) {
+    if (pos_ >= size_)
+      return false;
+
+    bool joined = false;
+
+    while (true) {
+      const char *start = data_ + pos_;
+      const char *nl    = static_cast<const char *>(::memchr(start, '\n', size_ - pos_));
+
+      size_t len = (nl ? size_t(nl - start) : size_ - pos_);
+
+      pos_ += len + (nl ? 1 : 0);
+
+      // odd number of trailing backslashes is a continuation
+      size_t nb = 0;
+
+      while (nb < len && start[len - nb - 1] == '\\')
+        ++nb;
+
+      bool cont = (nl && (nb & 1));
+
+      if (! cont && ! joined) {
+        line = std::string_view(start, len);
+        return true;
+      }
+
+      if (! joined) {
+        scratch_.clear();
+
+        joined = true;
+      }
+
+      scratch_.append(start, cont ? len - 1 : len);
+
+      if (! cont || pos_ >= size_)
+        break;
+    }
+
+    line = std::string_view(scratch_);
+
+    return true;
+  }
+
+ private:
+  const char* data_   { nullptr };
+  size_t      size_   { 0 };
+  size_t      pos_    { 0 };
+  bool        mapped_ { false };
+  std::string buffer_;
+  std::string scratch_;
+};
+
+// read lower case directive keyword at pos and skip following space. Keyword
+// must be followed by space, comment or end of line (empty if none).
+static std::string_view
+CMakeReadKeyword(std::string_view line, size_t &i)
+{
+  auto len = line.size();
+  auto i1  = i;
+
+  while (i < len && islower(static_cast<unsigned char>(line[i])))
+    ++i;
+
+  auto keyword = line.substr(i1, i - i1);
+
+  if (keyword.empty() || (i < len && line[i] != ' ' && line[i] != '\t' && line[i] != '#')) {
+    i = i1;
+
+    return std::string_view();
+  }
+
+  while (i < len && (line[i] == ' ' || line[i] == '\t'))
+    ++i;
+
+  return keyword;
+}
+
+// get variable assignment operator at start of string (empty if none)
+static std::string_view
+CMakeAssignOp(std::string_view str)
+{
+  static const std::string_view ops[] = { "=", "?=", "::=", ":=", "+=", "!=" };
+
+  for (const auto &op : ops) {
+    if (str.compare(0, op.size(), op) == 0)
+      return op;
+  }
+
+  return std::string_view();
+}
+
+// split variable assignment (name op value)
+static bool
+CMakeParseAssign(std::string_view str, std::string &name, std::string &op,
+                 std::string &value)
+{
+  size_t i   = 0;
+  auto   len = str.size();
+
+  while (i < len && isspace(static_cast<unsigned char>(str[i])))
+    ++i;
+
+  auto i1 = i;
+
+  while (i < len && ! isspace(static_cast<unsigned char>(str[i])) &&
+         std::string_view("=:?+!").find(str[i]) == std::string_view::npos)
+    ++i;
+
+  if (i == i1)
+    return false;
+
+  name = str.substr(i1, i - i1);
+
+  while (i < len && isspace(static_cast<unsigned char>(str[i])))
+    ++i;
+
+  auto op1 = CMakeAssignOp(str.substr(i));
+
+  if (op1.empty())
+    return false;
+
+  op = op1;
+
+  i += op1.size();
+
+  while (i < len && isspace(static_cast<unsigned char>(str[i])))
+    ++i;
+
+  value = str.substr(i);
+
+  return true;
 }
 
 bool
@@ -101,59 +443,54 @@ processFile(const std::string &filename, bool silent)
   if (isDebug())
     std::cerr << "Process " << filename << "\n";
 
-  CFile file(filename);
+  // record all makefiles tried (missing files too) for build db and parse cache
+  makefiles_.push_back(symbols_.intern(filename));
 
-  if (! file.open(CFileBase::Mode::READ)) {
+  CMakeLineReader reader;
+
+  if (! reader.open(filename)) {
     if (! silent) std::cerr << "Failed to open '" << filename << "'\n";
     return false;
   }
 
-  using Lines = std::vector<std::string>;
-
-  Lines lines;
+  std::string_view lineView;
+  std::string      line;
+  Define           define;
 
-  while (! file.eof()) {
-    std::string line;
+  // makefiles being read (VPATH and rules not final)
+  ++parseDepth_;
 
-    while (! file.eof()) {
-      int c = file.getC();
+  while (reader.nextLine(lineView)) {
+    // define body is read literally up to the matching endef
+    if (define.depth > 0) {
+      processDefineLine(lineView, define);
+      continue;
+    }
 
-      if (c == EOF)
-        break;
+    // conditionals are handled before anything else so lines in inactive
+    // blocks are skipped without expansion or parsing (and do not end rule)
+    if (processConditional(lineView))
+      continue;
 
-      if    (c == '\\') {
-        if (! file.eof()) {
-          int c1 = file.getC();
+    if (! isBlockActive()) {
+      // skip define body (may contain conditional keywords)
+      if (isDefineLine(lineView)) {
+        define = Define();
 
-          if (c1 == '\n')
-            continue;
-          else {
-            line += char(c);
-            line += char(c1);
-          }
-        }
-        else
-          line += char(c);
+        define.depth = 1;
       }
-      else if (c == '\n')
-        break;
-      else
-        line += char(c);
+
+      continue;
     }
 
-    lines.push_back(line);
+    line.assign(lineView.data(), lineView.size());
 
     if (isDebug())
       std::cerr << "Line: " << line << "\n";
-  }
 
-  for (auto &line : lines) {
     CStrParse parse(line);
 
     if (parse.isChar('\t')) {
-      if (! isBlockActive())
-        continue;
-
       parse.skipChar();
 
       auto value = parse.getAt();
@@ -182,10 +519,17 @@ processFile(const std::string &filename, bool silent)
         if (isDebug())
           std::cerr << "ADD RULE " << rule_->lhs() << " : " << value1 << "\n";
 
-        auto *cmd = rule_->addCmd(value1);
+        // first command of rule line replaces any previous commands
+        if (newRuleCmds_) {
+          startRuleCmds(rule_);
+
+          newRuleCmds_ = false;
+        }
+
+        auto &cmd = rule_->addCmd(value1);
 
-        cmd->setSilent(silent1);
-        cmd->setIgnore(ignore1);
+        cmd.setSilent(silent1);
+        cmd.setIgnore(ignore1);
       }
       else {
         std::cerr << "NO CURRENT RULE: " << line << "\n";
@@ -206,7 +550,7 @@ processFile(const std::string &filename, bool silent)
     if (parse.isChar('#'))
       continue;
 
-    if (parse.isAlpha() || parse.isOneOf(".")) {
+    if (parse.isAlpha() || parse.isOneOf(".") || parse.isString("-include")) {
       std::string name;
 
       while (! parse.eof() && (parse.isAlnum() || parse.isOneOf("_-.")))
@@ -219,59 +563,17 @@ processFile(const std::string &filename, bool silent)
       // define variable +=
       // define variable ?=
       if      (name == "define") {
-        std::cerr << "TODO: " << line << "\n";
+        startDefine(parse.getAt(), define, /*override*/false, /*exported*/false);
       }
       // endef
       else if (name == "endef") {
-        std::cerr << "TODO: " << line << "\n";
+        std::cerr << "endef without define\n";
       }
       // undefine variable
       else if (name == "undefine") {
-        std::cerr << "TODO: " << line << "\n";
-      }
-      // ifdef variable
-      else if (name == "ifdef") {
-        parse.skipSpace();
-
-        auto value = parse.getAt();
-
-        value = replaceVariables(value);
-
-        bool b = isVariable(value);
-
-        startBlock(b);
-      }
-      // ifndef variable
-      else if (name == "ifndef") {
         parse.skipSpace();
 
-        auto value = parse.getAt();
-
-        value = replaceVariables(value);
-
-        bool b = ! isVariable(value);
-
-        startBlock(b);
-      }
-      // ifeq (a,b)
-      // ifeq "a" "b"
-      // ifeq 'a' 'b'
-      else if (name == "ifeq") {
-        std::cerr << "TODO: " << line << "\n";
-      }
-      // ifneq (a,b)
-      // ifneq "a" "b"
-      // ifneq 'a' 'b'
-      else if (name == "ifneq") {
-        std::cerr << "TODO: " << line << "\n";
-      }
-      // else
-      else if (name == "else") {
-        std::cerr << "TODO: " << line << "\n";
-      }
-      // endif
-      else if (name == "endif") {
-        endBlock();
+        undefineVariable(replaceVariables(parse.getAt()));
       }
       // include file
       // -include file
@@ -288,505 +590,6364 @@ processFile(const std::string &filename, bool silent)
         if (isDebug())
           std::cerr << "INCLUDE: " << value << "\n";
 
-        Words files;
+        // TODO: search include path (if not absolute)
+        WordViews files;
+
+        splitWords(value, files);
 
-        stringToFiles(value, files);
+        for (const auto &file1 : files) {
+          std::string file2(file1);
 
-        for (const auto &file1 : files)
-          processFile(file1, silent1);
+          // compiler dependency files use fast dependency line parser
+          if (isDepFile(file2) && processDepFile(file2))
+            continue;
+
+          processFile(file2, silent1);
+        }
       }
       // override variable-assignment
-      else if (name == "override") {
-        std::cerr << "TODO: " << line << "\n";
-      }
       // export
       // export variable
-      // export variable-assignmentxport
-      else if (name == "export") {
-        std::cerr << "TODO: " << line << "\n";
-      }
-      // unexport variable
-      else if (name == "unexport") {
-        std::cerr << "TODO: " << line << "\n";
-      }
+      // export variable-assignment
+      // unexport
       // unexport variable
-      else if (name == "unexport") {
-        std::cerr << "TODO: " << line << "\n";
-      }
       // private variable-assignment
-      else if (name == "private") {
-        std::cerr << "TODO: " << line << "\n";
+      else if (name == "override" || name == "export" ||
+               name == "unexport" || name == "private") {
+        processModifiers(name, parse.getAt(), define);
       }
       // vpath pattern path
       // vpath pattern
       // vpath
       else if (name == "vpath") {
-        std::cerr << "TODO: " << line << "\n";
+        parse.skipSpace();
+
+        auto value = replaceVariables(parse.getAt());
+
+        auto pos = value.find_first_of(" \t");
+
+        if (pos != std::string::npos)
+          addVPath(value.substr(0, pos), value.substr(pos + 1));
+        else
+          addVPath(value, "");
       }
       else {
-        if (! isBlockActive())
-          continue;
-
         parse.skipSpace();
 
-        // set name value
-        if      (parse.isChar('=')) {
-          parse.skipChar();
+        auto op = CMakeAssignOp(parse.getAt());
+
+        // variable assignment (=, ?=, :=, ::=, += or !=)
+        if      (! op.empty()) {
+          parse.skipChar(int(op.size()));
 
           parse.skipSpace();
 
-          auto value = parse.getAt();
+          assignVariable(name, std::string(op), parse.getAt());
+        }
+        // rule
+        else if (parse.isChar(':')) {
+          parse.skipChar();
 
-          defineVariable(name, value, /*deferred*/true);
+          parseRuleLine(name, parse.getAt());
         }
-        // set deferred name value
-        else if (parse.isString("?=")) {
-          parse.skipChar(2);
+        else {
+          // rule with target which is not a simple name (e.g. dir/file)
+          auto pos = findRuleColon(line);
 
-          parse.skipSpace();
+          if (pos != std::string::npos)
+            parseRuleLine(line.substr(0, pos), line.substr(pos + 1));
+          else
+            std::cerr << "BAD LINE: " << line << "\n";
+        }
+      }
+    }
+    else {
+      auto pos = findRuleColon(line);
 
-          auto value = parse.getAt();
+      if (pos != std::string::npos)
+        parseRuleLine(line.substr(0, pos), line.substr(pos + 1));
+      else
+        std::cerr << "BAD LINE: " << line << "\n";
+    }
+  }
 
-          defineVariable(name, value, /*deferred*/true);
-        }
-        // set name value
-        else if (parse.isString(":=")) {
-          parse.skipChar(2);
+  if (define.depth > 0)
+    std::cerr << "Missing endef in '" << filename << "'\n";
 
-          parse.skipSpace();
+  --parseDepth_;
 
-          auto value = parse.getAt();
+  return true;
+}
 
-          value = replaceVariables(value);
+// parse rule line (lhs and rhs either side of rule ':')
+//  targets : prerequisites
+//  targets :: prerequisites (double colon rule)
+//  targets : target-pattern : prereq-patterns (static pattern rule)
+void
+CMake::
+parseRuleLine(const std::string &lhs, const std::string &rhs)
+{
+  bool doubleColon = (! rhs.empty() && rhs[0] == ':');
 
-          defineVariable(name, value, /*deferred*/false);
-        }
-        // set deferred name value
-        else if (parse.isString("::=")) {
-          parse.skipChar(3);
+  auto rhs1 = rhs.substr(doubleColon ? 1 : 0);
 
-          parse.skipSpace();
+  auto lhs1 = replaceVariables(lhs);
 
-          auto value = parse.getAt();
+  // grouped targets (a b &: prereqs)
+  while (! lhs1.empty() && isspace(static_cast<unsigned char>(lhs1.back())))
+    lhs1.pop_back();
 
-          value = replaceVariables(value);
+  bool grouped = (! lhs1.empty() && lhs1.back() == '&');
 
-          defineVariable(name, value, /*deferred*/false);
-        }
-        // append to name value
-        else if (parse.isString("+=")) {
-          parse.skipChar(2);
+  if (grouped)
+    lhs1.pop_back();
 
-          parse.skipSpace();
+  WordViews targets;
 
-          auto value = parse.getAt();
+  splitWords(lhs1, targets);
 
-          bool deferred = false;
+  auto pos = findRuleColon(rhs1);
 
-          if (isVariable(name)) {
-          }
+  newRuleCmds_ = true;
 
-          if (! deferred)
-            value = replaceVariables(value);
+  if (doubleColon && (grouped || pos != std::string::npos)) {
+    std::cerr << "Double colon not supported for " <<
+                 (grouped ? "grouped targets" : "static pattern rule") <<
+                 " '" << lhs1 << "' (treated as single colon)\n";
 
-          defineVariable(name, value, deferred);
-        }
-        // set name value
-        else if (parse.isString("!=")) {
-          parse.skipChar(2);
+    doubleColon = false;
+  }
 
-          parse.skipSpace();
+  if (pos != std::string::npos) {
+    rule_ = defineStaticPatternRules(lhs1, rhs1.substr(0, pos), rhs1.substr(pos + 1));
+    return;
+  }
 
-          auto value = parse.getAt();
+  // prerequisites | order only prerequisites
+  auto rhs2 = replaceVariables(rhs1);
 
-          value = replaceVariables(value);
+  auto opos = rhs2.find('|');
 
-          defineVariable(name, value, /*deferred*/false);
-        }
-        // rule
-        else if (parse.isChar(':')) {
-          parse.skipChar();
+  SymbolIds rids, oids;
 
-          parse.skipSpace();
+  wordsToSymbols(std::string_view(rhs2).substr(0, opos), rids);
 
-          name = replaceVariables(name);
+  if (opos != std::string::npos)
+    wordsToSymbols(std::string_view(rhs2).substr(opos + 1), oids);
 
-          auto value = parse.getAt();
+  // each target gets a new double colon rule (sharing the commands of the first)
+  if (doubleColon) {
+    Rule *cmdRule = nullptr;
 
-          Words rwords;
+    for (const auto &target : targets) {
+      auto *rule = defineDoubleColonRule(std::string(target), rids);
 
-          stringToWords(value, rwords);
+      if (! rule)
+        continue;
 
-          rule_ = defineRule(name, rwords);
-        }
-        else {
-          std::cerr << "BAD LINE: " << line << "\n";
-        }
-      }
+      rule->addOids(oids);
+
+      if      (! cmdRule)
+        cmdRule = rule;
+      else if (rule->isDoubleColon() && cmdRule->isDoubleColon())
+        rule->setCmdRule(cmdRule);
     }
-    else {
-      std::string lhs;
 
-      while (! parse.eof() && ! parse.isChar(':'))
-        lhs += parse.readChar();
+    rule_ = cmdRule;
+    return;
+  }
 
-      if (parse.isChar(':')) {
-        parse.skipChar();
+  if (targets.size() > 1 || grouped)
+    rule_ = defineMultiTargetRules(targets, rids, oids, grouped);
+  else {
+    rule_ = defineRule(! targets.empty() ? std::string(targets[0]) : "", rids);
 
-        parse.skipSpace();
+    if (rule_)
+      rule_->addOids(oids);
+  }
+}
 
-        auto rhs = parse.getAt();
+// start commands of rule line. A target with commands from another rule
+// line, or sharing the commands of a multiple target rule, gets its own.
+void
+CMake::
+startRuleCmds(Rule *rule)
+{
+  if (! rule->hasCmds() && ! rule->cmdRule())
+    return;
 
-        lhs = replaceVariables(lhs);
+  if (rule->hasCmds())
+    std::cerr << "Warning: overriding commands for target '" << rule->lhs() << "'\n";
 
-        Words rwords;
+  rule->detachCmds();
+}
 
-        stringToWords(rhs, rwords);
+// find rule separator ':' (outside variable references)
+size_t
+CMake::
+findRuleColon(std::string_view str)
+{
+  int depth = 0;
 
-        rule_ = defineRule(lhs, rwords);
-      }
-      else {
-        std::cerr << "BAD LINE: " << line << "\n";
-      }
+  for (size_t i = 0; i < str.size(); ++i) {
+    char c = str[i];
+
+    if      (c == '$' && i + 1 < str.size() && (str[i + 1] == '(' || str[i + 1] == '{')) {
+      ++depth;
+      ++i;
     }
+    else if (depth > 0 && (c == ')' || c == '}'))
+      --depth;
+    else if (depth == 0 && c == ':')
+      return i;
   }
 
-  return true;
+  return std::string::npos;
 }
 
+// split (already expanded) string into words and intern them
 void
 CMake::
-stringToFiles(const std::string &str, Words &words)
+wordsToSymbols(std::string_view str, SymbolIds &ids)
 {
-  // TODO: skip comment text
-  // TODO: search include path (if not absolute)
-
-  CStrParse parse(str);
-
-  parse.skipSpace();
-
-  while (! parse.eof()) {
-    std::string word;
+  WordViews views;
 
-    while (! parse.eof() && ! parse.isSpace())
-      word += parse.readChar();
+  splitWords(str, views);
 
-    if (word == "")
-      continue;
-
-    std::string word1 = replaceVariables(word);
+  ids.reserve(ids.size() + views.size());
 
-    words.push_back(word1);
-
-    parse.skipSpace();
-  }
+  for (const auto &view : views)
+    ids.push_back(symbols_.intern(view));
 }
 
+// split string into space separated words (views into str)
 void
 CMake::
-stringToWords(const std::string &str, Words &words)
+splitWords(std::string_view str, WordViews &words)
 {
-  CStrParse parse(str);
-
-  parse.skipSpace();
+  const char *p  = str.data();
+  const char *pe = p + str.size();
 
-  while (! parse.eof()) {
-    std::string word;
+  while (true) {
+    while (p < pe && isspace(static_cast<unsigned char>(*p)))
+      ++p;
 
-    while (! parse.eof() && ! parse.isSpace())
-      word += parse.readChar();
-
-    if (word == "")
-      continue;
+    if (p >= pe)
+      break;
 
-    std::string word1 = replaceVariables(word);
+    const char *p1 = p;
 
-    words.push_back(word1);
+    while (p < pe && ! isspace(static_cast<unsigned char>(*p)))
+      ++p;
 
-    parse.skipSpace();
+    words.emplace_back(p1, size_t(p - p1));
   }
 }
 
-void
+bool
 CMake::
 make()
 {
   if (! defRule())
-    return;
+    return true;
 
-  make(defRule());
+  return make(defRule());
 }
 
-void
+bool
 CMake::
 make(const std::string &name)
 {
-  Rule *rule = getRule(name);
+  auto id = symbols_.intern(name);
 
-  if (rule)
-    make(rule);
-}
+  Rule *rule = getRule(id);
 
+  if (! rule) {
+    if (fileStat(vpathFile(id)).exists)
+      return true;
+
+    std::cerr << "No rule to make target '" << name << "'\n";
+    return false;
+  }
+
+  return make(rule);
+}
+
+bool
+CMake::
+make(Rule *rule)
+{
+  if (numJobs() > 1)
+    return makeParallel(rule);
+
+  return makeSerial(rule);
+}
+
+bool
+CMake::
+makeSerial(Rule *rule)
+{
+  if (! rule->isDoubleColon())
+    return makeSerialRule(rule);
+
+  // double colon rules of target are made in order
+  bool rc = true;
+
+  for (auto *rule1 = rule; rule1; rule1 = rule1->nextColon()) {
+    if (! makeSerialRule(rule1)) {
+      rc = false;
+
+      if (! isKeepGoing())
+        break;
+    }
+  }
+
+  invalidateFileStat(rule->lhsId());
+
+  return rc;
+}
+
+bool
+CMake::
+makeSerialRule(Rule *rule)
+{
+  // grouped targets are made as one rule
+  rule = rule->groupLeader();
+
+  // each rule is only visited once per run
+  auto state = targetState(rule);
+
+  if (state == TargetState::IN_PROGRESS) {
+    circularDependency(ruleStack_, rule);
+    return true;
+  }
+
+  if (isTargetDone(state))
+    return (state != TargetState::FAILED);
+
+  if (isDebug()) {
+    std::cerr << "MAKE " << rule->lhs() << "\n";
+
+    rule->print();
+  }
+
+  setTargetState(rule, TargetState::IN_PROGRESS);
+
+  ruleStack_.push_back(rule);
+
+  // make prerequisites first so their new times are seen by outOfDate (order
+  // only prerequisites are made but their times are not checked)
+  bool rc = true;
+
+  for (const auto *ids : { &rule->rids(), &rule->oids() }) {
+    for (const auto &rid : *ids) {
+      auto *rule1 = getRule(rid);
+
+      if (rule1 && ! makeSerial(rule1)) {
+        rc = false;
+
+        if (! isKeepGoing())
+          break;
+      }
+    }
+
+    if (! rc && ! isKeepGoing())
+      break;
+  }
+
+  // then generated headers found by include scan (repeated as made headers can
+  // include more generated headers)
+  bool madeIncludes = (rc && isScanIncludes());
+
+  while (madeIncludes) {
+    madeIncludes = false;
+
+    RuleArray rules;
+
+    ruleGeneratedIncludes(rule, rules);
+
+    for (auto *rule1 : rules) {
+      if (targetState(rule1) != TargetState::UNVISITED)
+        continue;
+
+      madeIncludes = true;
+
+      if (! makeSerial(rule1)) {
+        rc = false;
+
+        if (! isKeepGoing())
+          break;
+      }
+    }
+
+    if (! rc)
+      break;
+  }
+
+  ruleStack_.pop_back();
+
+  if (! rc) {
+    setTargetState(rule, TargetState::FAILED);
+    return false;
+  }
+
+  if (! needsBuild(rule)) {
+    setTargetState(rule, TargetState::UP_TO_DATE);
+    return true;
+  }
+
+  ExecCmds execCmds;
+
+  buildCmds(rule, execCmds);
+
+  // restore outputs from artifact cache instead of running commands
+  if (isArtifactCache() && restoreArtifacts(rule, execCmds))
+    rc = true;
+  else
+    rc = runCmds(execCmds);
+
+  ruleBuilt(rule, execCmds, rc);
+
+  setTargetState(rule, rc ? TargetState::REBUILT : TargetState::FAILED);
+
+  return rc;
+}
+
+CMake::TargetState
+CMake::
+targetState(const Rule *rule) const
+{
+  auto p = targetStates_.find(rule->groupLeader());
+
+  if (p == targetStates_.end())
+    return TargetState::UNVISITED;
+
+  return (*p).second;
+}
+
+void
+CMake::
+setTargetState(const Rule *rule, TargetState state)
+{
+  targetStates_[rule->groupLeader()] = state;
+}
+
+void
+CMake::
+circularDependency(const std::vector<const Rule *> &chain, const Rule *rule) const
+{
+  auto p = std::find(chain.begin(), chain.end(), rule);
+
+  std::cerr << "Circular dependency dropped:";
+
+  for ( ; p != chain.end(); ++p)
+    std::cerr << " " << (*p)->lhs() << " ->";
+
+  std::cerr << " " << rule->lhs() << "\n";
+}
+
+bool
+CMake::
+needsBuild(Rule *rule)
+{
+  // group needs build if any target does
+  if (rule->isGrouped()) {
+    for (auto *rule1 : rule->group()) {
+      if (targetNeedsBuild(rule1))
+        return true;
+    }
+
+    return false;
+  }
+
+  return targetNeedsBuild(rule);
+}
+
+bool
+CMake::
+targetNeedsBuild(Rule *rule)
+{
+  if (rule->isPhony())
+    return true;
+
+  // double colon rule without prerequisites always runs its commands
+  if (rule->isDoubleColon() && rule->rids().empty())
+    return true;
+
+  // build records are per target so not used for double colon rules
+  bool useRecord = ! rule->isDoubleColon();
+
+  if (outOfDate(rule->lhsId(), rule->rids()) ||
+      (isScanIncludes() && includesOutOfDate(rule))) {
+    // newer inputs with unchanged contents don't need build
+    if (! isContentHash() || ! useRecord || ! inputsUnchanged(rule))
+      return true;
+  }
+
+  if (isBuildDb() && useRecord && buildDbOutOfDate(rule))
+    return true;
+
+  return false;
+}
+
+// update file state and build records of target (all targets of group)
+// after commands are run
+void
+CMake::
+ruleBuilt(Rule *rule, const ExecCmds &execCmds, bool rc)
+{
+  auto update = [&](Rule *rule1) {
+    // double colon rules all compare with the target's time before any are
+    // run (updated once all are made)
+    if (! rule1->isDoubleColon())
+      invalidateFileStat(rule1->lhsId());
+
+    // rebuilt file (generated source or header) is rescanned for includes
+    if (isScanIncludes()) {
+      for (auto &pd : dirsIncludes_)
+        pd.second.erase(rule1->lhsId());
+    }
+
+    if (rc && isBuildDb() && ! rule1->isDoubleColon())
+      updateBuildRecord(rule1, execCmds);
+  };
+
+  if (rule->isGrouped()) {
+    for (auto *rule1 : rule->group())
+      update(rule1);
+  }
+  else
+    update(rule);
+
+  // store outputs of commands run for artifact cache miss
+  if (isArtifactCache()) {
+    if (rc)
+      storeArtifacts(rule);
+    else
+      artifactKeys_.erase(rule);
+  }
+}
+
+//---
+
+// Pool of worker threads running the (already expanded) commands of a rule.
+// Only the commands run on the workers, all rule state (out of date checks,
+// variable expansion, ...) is handled by the scheduling thread.
+class CMakeJobPool {
+ public:
+  using Exec = std::function<bool ()>;
+
+  struct Job {
+    int  id { 0 };
+    Exec exec;
+    bool rc { false };
+  };
+
+ public:
+  CMakeJobPool(int n) {
+    for (int i = 0; i < n; ++i)
+      threads_.emplace_back([this]() { run(); });
+  }
+
+ ~CMakeJobPool() {
+    {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    done_ = true;
+    }
+
+    startCond_.notify_all();
+
+    for (auto &thread : threads_)
+      thread.join();
+  }
+
+  void submit(int id, const Exec &exec) {
+    {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    Job job;
+
+    job.id   = id;
+    job.exec = exec;
+
+    pending_.push_back(job);
+    }
+
+    startCond_.notify_one();
+  }
+
+  // wait for next finished job
+  Job wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    finishCond_.wait(lock, [this]() { return ! finished_.empty(); });
+
+    auto job = finished_.front();
+
+    finished_.pop_front();
+
+    return job;
+  }
+
+ private:
+  void run() {
+    while (true) {
+      Job job;
+
+      {
+      std::unique_lock<std::mutex> lock(mutex_);
+
+      startCond_.wait(lock, [this]() { return done_ || ! pending_.empty(); });
+
+      if (pending_.empty())
+        return;
+
+      job = pending_.front();
+
+      pending_.pop_front();
+      }
+
+      job.rc = job.exec();
+
+      {
+      std::unique_lock<std::mutex> lock(mutex_);
+
+      finished_.push_back(job);
+      }
+
+      finishCond_.notify_one();
+    }
+  }
+
+ private:
+  using Threads = std::vector<std::thread>;
+  using Jobs    = std::deque<Job>;
+
+  Threads                 threads_;
+  std::mutex              mutex_;
+  std::condition_variable startCond_;
+  std::condition_variable finishCond_;
+  Jobs                    pending_;
+  Jobs                    finished_;
+  bool                    done_ { false };
+};
+
+bool
+CMake::
+makeParallel(Rule *rule)
+{
+  // build dependency graph of rules reachable from rule which have not
+  // already been made this run
+  struct Node {
+    Rule*                     rule    { nullptr };
+    std::shared_ptr<ExecCmds> execCmds;
+    std::vector<Node *>       parents;
+    Node*                     next    { nullptr }; // next double colon rule
+    int                       pending { 0 };
+    bool                      failed  { false };
+    bool                      done    { false };
+    bool                      onStack { false };
+  };
+
+  using NodeMap = std::map<Rule *,Node *>;
+
+  NodeMap   nodes;
+  RuleStack chain;
+
+  std::vector<Node *> added;
+
+  // node which completes target (last of double colon rules)
+  auto lastNode = [](Node *node) {
+    while (node->next)
+      node = node->next;
+
+    return node;
+  };
+
+  std::function<Node *(Rule *)> addNode = [&](Rule *rule1) {
+    // grouped targets are one node
+    rule1 = rule1->groupLeader();
+
+    auto p = nodes.find(rule1);
+
+    if (p != nodes.end())
+      return (*p).second;
+
+    auto *node = new Node;
+
+    node->rule    = rule1;
+    node->onStack = true;
+
+    nodes[rule1] = node;
+
+    added.push_back(node);
+
+    setTargetState(rule1, TargetState::IN_PROGRESS);
+
+    chain.push_back(rule1);
+
+    // prerequisites and order only prerequisites are made first
+    for (const auto *ids : { &rule1->rids(), &rule1->oids() }) {
+      for (const auto &rid : *ids) {
+        auto *rule2 = getRule(rid);
+
+        if (! rule2)
+          continue;
+
+        auto state = targetState(rule2);
+
+        if (isTargetDone(state)) {
+          if (state == TargetState::FAILED)
+            node->failed = true;
+
+          continue;
+        }
+
+        auto p1 = nodes.find(rule2->groupLeader());
+
+        if (p1 != nodes.end() && (*p1).second->onStack) {
+          circularDependency(chain, rule2);
+          continue;
+        }
+
+        auto *node1 = lastNode(addNode(rule2));
+
+        node1->parents.push_back(node);
+
+        ++node->pending;
+      }
+    }
+
+    // next double colon rule of target runs after this one
+    if (rule1->nextColon()) {
+      node->next = addNode(rule1->nextColon());
+
+      node->parents.push_back(node->next);
+
+      ++node->next->pending;
+    }
+
+    chain.pop_back();
+
+    node->onStack = false;
+
+    return node;
+  };
+
+  auto state = targetState(rule);
+
+  if (isTargetDone(state))
+    return (state != TargetState::FAILED);
+
+  auto *root = lastNode(addNode(rule));
+
+  //---
+
+  std::deque<Node *> ready;
+
+  auto readyAdded = [&]() {
+    for (auto *node : added) {
+      if (node->pending == 0)
+        ready.push_back(node);
+    }
+
+    added.clear();
+  };
+
+  readyAdded();
+
+  // check if node depends (directly or indirectly) on node1 (each node above
+  // node1 is visited once)
+  auto dependsOn = [&](Node *node, Node *node1) {
+    std::unordered_set<Node *> visited;
+
+    std::vector<Node *> todo { node1 };
+
+    while (! todo.empty()) {
+      auto *node2 = todo.back();
+
+      todo.pop_back();
+
+      for (auto *parent : node2->parents) {
+        if (parent == node)
+          return true;
+
+        if (visited.insert(parent).second)
+          todo.push_back(parent);
+      }
+    }
+
+    return false;
+  };
+
+  // add nodes for generated headers found by include scan once prerequisites
+  // are made (returns true if node must wait for them)
+  auto addIncludeNodes = [&](Node *node) {
+    RuleArray rules;
+
+    ruleGeneratedIncludes(node->rule, rules);
+
+    for (auto *rule1 : rules) {
+      rule1 = rule1->groupLeader();
+
+      if (rule1 == node->rule || isTargetDone(targetState(rule1)))
+        continue;
+
+      Node *node1 = nullptr;
+
+      auto p = nodes.find(rule1);
+
+      if (p != nodes.end()) {
+        node1 = lastNode((*p).second);
+
+        if (node1->done)
+          continue;
+
+        if (dependsOn(node1, node)) {
+          circularDependency(RuleStack { rule1, node->rule }, rule1);
+          continue;
+        }
+      }
+      else {
+        chain.push_back(node->rule);
+
+        node->onStack = true;
+
+        node1 = lastNode(addNode(rule1));
+
+        node->onStack = false;
+
+        chain.pop_back();
+      }
+
+      node1->parents.push_back(node);
+
+      ++node->pending;
+    }
+
+    readyAdded();
+
+    return (node->pending > 0);
+  };
+
+  CMakeJobPool pool(numJobs());
+
+  std::map<int,Node *> running;
+
+  int  jobId  = 0;
+  bool failed = false;
+
+  auto finishNode = [&](Node *node, bool rc, bool built) {
+    node->done = true;
+
+    if (! rc) {
+      node->failed = true;
+
+      failed = true;
+    }
+
+    if      (node->failed)
+      setTargetState(node->rule, TargetState::FAILED);
+    else if (built)
+      setTargetState(node->rule, TargetState::REBUILT);
+    else
+      setTargetState(node->rule, TargetState::UP_TO_DATE);
+
+    if (node->rule->isDoubleColon() && ! node->next)
+      invalidateFileStat(node->rule->lhsId());
+
+    for (auto *parent : node->parents) {
+      if (node->failed)
+        parent->failed = true;
+
+      if (--parent->pending == 0)
+        ready.push_back(parent);
+    }
+  };
+
+  while (true) {
+    // start ready rules (stop starting new work on failure unless keep going)
+    while (! ready.empty() && int(running.size()) < numJobs()) {
+      auto *node = ready.front();
+
+      ready.pop_front();
+
+      if (failed && ! isKeepGoing()) {
+        node->failed = true;
+        node->done   = true;
+
+        setTargetState(node->rule, TargetState::FAILED);
+        continue;
+      }
+
+      if (node->failed) {
+        finishNode(node, false, false);
+        continue;
+      }
+
+      if (isScanIncludes() && addIncludeNodes(node))
+        continue;
+
+      if (isDebug())
+        std::cerr << "MAKE " << node->rule->lhs() << "\n";
+
+      if (! needsBuild(node->rule)) {
+        finishNode(node, true, false);
+        continue;
+      }
+
+      auto execCmds = std::make_shared<ExecCmds>();
+
+      buildCmds(node->rule, *execCmds);
+
+      if (isArtifactCache() && restoreArtifacts(node->rule, *execCmds)) {
+        ruleBuilt(node->rule, *execCmds, true);
+
+        finishNode(node, true, true);
+        continue;
+      }
+
+      node->execCmds = execCmds;
+
+      ++jobId;
+
+      running[jobId] = node;
+
+      pool.submit(jobId, [this, execCmds]() { return runCmds(*execCmds); });
+    }
+
+    if (running.empty())
+      break;
+
+    auto job = pool.wait();
+
+    auto p = running.find(job.id);
+
+    auto *node = (*p).second;
+
+    running.erase(p);
+
+    ruleBuilt(node->rule, *node->execCmds, job.rc);
+
+    node->execCmds.reset();
+
+    finishNode(node, job.rc, true);
+  }
+
+  bool rc = (root->done && ! root->failed);
+
+  for (auto &pn : nodes) {
+    // rules never started (stopped on failure) are failed
+    if (! pn.second->done)
+      setTargetState(pn.first, TargetState::FAILED);
+
+    delete pn.second;
+  }
+
+  return rc;
+}
+
+void
+CMake::
+expandCmds(Rule *rule, ExecCmds &execCmds) const
+{
+  auto volatileCalls = volatileCalls_;
+
+  AutoVars autoVars(this, rule);
+
+  auto env = commandEnv();
+
+  for (auto &cmd : rule->cmds()) {
+    ExecCmd execCmd;
+
+    // compile command once and reuse for each expansion
+    if (! cmd.expansion()) {
+      auto expansion = std::make_shared<Expansion>();
+
+      compileExpansion(cmd.cmd(), *expansion);
+
+      cmd.setExpansion(expansion);
+    }
+
+    expandTo(*cmd.expansion(), execCmd.cmd, &autoVars);
+
+    execCmd.silent = cmd.isSilent();
+    execCmd.ignore = cmd.isIgnore();
+    execCmd.env    = env;
+
+    // canned recipe (define) expands to one command per line (each with its
+    // own @ and - prefixes)
+    if (execCmd.cmd.find('\n') == std::string::npos) {
+      execCmds.push_back(std::move(execCmd));
+      continue;
+    }
+
+    std::string_view cmds(execCmd.cmd);
+
+    size_t pos = 0;
+
+    while (pos < cmds.size()) {
+      auto pos1 = cmds.find('\n', pos);
+
+      if (pos1 == std::string_view::npos)
+        pos1 = cmds.size();
+
+      auto line = cmds.substr(pos, pos1 - pos);
+
+      pos = pos1 + 1;
+
+      ExecCmd execCmd1;
+
+      execCmd1.silent = execCmd.silent;
+      execCmd1.ignore = execCmd.ignore;
+      execCmd1.env    = env;
+
+      while (! line.empty() && (isspace(static_cast<unsigned char>(line[0])) ||
+                                line[0] == '@' || line[0] == '-' || line[0] == '+')) {
+        if      (line[0] == '@')
+          execCmd1.silent = true;
+        else if (line[0] == '-')
+          execCmd1.ignore = true;
+
+        line.remove_prefix(1);
+      }
+
+      if (line.empty())
+        continue;
+
+      execCmd1.cmd = line;
+
+      execCmds.push_back(std::move(execCmd1));
+    }
+  }
+
+  // expansion can differ between runs so build db must always check it
+  if (volatileCalls_ != volatileCalls)
+    volatileCmds_.insert(rule);
+}
+
+// expand commands of rule to run (reuses expansion from build db check so
+// $(shell) in commands is only run once)
+void
+CMake::
+buildCmds(Rule *rule, ExecCmds &execCmds)
+{
+  auto p = expandedCmds_.find(rule);
+
+  if (p == expandedCmds_.end()) {
+    expandCmds(rule, execCmds);
+    return;
+  }
+
+  execCmds = std::move((*p).second);
+
+  expandedCmds_.erase(p);
+}
+
+// FNV-1a hash of string
+uint64_t
+CMake::
+hashString(std::string_view str, uint64_t hash)
+{
+  for (auto c : str) {
+    hash ^= uint64_t(static_cast<unsigned char>(c));
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+// hash of strings independent of their order (sorted and each hashed with a
+// terminator so adjacent strings can't run together)
+uint64_t
+CMake::
+hashStrings(std::vector<std::string_view> strs)
+{
+  std::sort(strs.begin(), strs.end());
+
+  uint64_t hash = hashString("");
+
+  for (const auto &str : strs) {
+    hash = hashString(str, hash);
+    hash = hashString(std::string_view("", 1), hash);
+  }
+
+  return hash;
+}
+
+// hash of process environment
+uint64_t
+CMake::
+environHash()
+{
+  std::vector<std::string_view> strs;
+
+  for (char **e = environ; e && *e; ++e)
+    strs.emplace_back(*e);
+
+  return hashStrings(std::move(strs));
+}
+
+uint64_t
+CMake::
+hashCmds(const ExecCmds &execCmds)
+{
+  uint64_t hash = hashString("");
+
+  for (const auto &execCmd : execCmds) {
+    hash = hashString(execCmd.cmd, hash);
+    hash = hashString("\n", hash);
+  }
+
+  return hash;
+}
+
+//---
+
+// Build database (.cmake_db) records, for each target, the hash of the
+// expanded commands and the prerequisite times when it was last built.
+//
+// A target is rebuilt if its prerequisites changed (added, removed or a
+// different time) or its expanded commands changed. Commands are only
+// expanded and compared when the makefiles, command line variables or
+// environment differ from when the database was written, or when their
+// last expansion ran $(shell) (not .SHELL_CACHE) or $(wildcard), so a no-op
+// build doesn't expand any commands.
+//
+// In content hash mode (-hash) the hash of each input is also recorded and
+// an input whose time changed is only a change if its contents did. Files
+// are only hashed when their time differs from the recorded time (or a
+// record is first written) so unchanged builds don't read any inputs.
+//
+// Format:
+//   # CMake build db <version>
+//   M <mtime> <makefile>
+//   E <hash> environment       (environment and command line variables)
+//   T <cmd hash> <target>
+//   V 1 <target>               (for previous T, commands always expanded)
+//   I <mtime> <prerequisite>   (for previous T)
+//   H <hash> <prerequisite>    (for previous I, content hash mode)
+
+bool
+CMake::
+loadBuildDb(const std::string &filename)
+{
+  buildDbFile_      = filename;
+  cmdInputsChanged_ = true;
+
+  std::ifstream is(filename);
+
+  if (! is)
+    return false;
+
+  std::string line;
+
+  if (! std::getline(is, line) || line != "# CMake build db 2") {
+    std::cerr << "Invalid build db '" << filename << "'\n";
+    return false;
+  }
+
+  FileIds makefiles(makefiles_.begin(), makefiles_.end());
+
+  size_t numMakefiles  = 0;
+  bool   makefilesSame = true;
+  bool   envSame       = false;
+
+  BuildRecord *record = nullptr;
+
+  while (std::getline(is, line)) {
+    if (line.size() < 2)
+      continue;
+
+    char type = line[0];
+
+    // <type> <number> <name>
+    const char *p = line.c_str() + 2;
+
+    char *pe;
+
+    auto value = strtoull(p, &pe, 10);
+
+    if (*pe != ' ')
+      continue;
+
+    auto id = symbols_.intern(std::string_view(pe + 1));
+
+    if      (type == 'M') {
+      if (makefiles.find(id) == makefiles.end() || fileStat(id).mtime != FileTime(value))
+        makefilesSame = false;
+
+      ++numMakefiles;
+    }
+    else if (type == 'E') {
+      envSame = (value == buildDbEnvHash());
+    }
+    else if (type == 'T') {
+      record = &buildRecords_[id];
+
+      record->cmdHash = value;
+    }
+    else if (type == 'V') {
+      if (record)
+        record->volatileCmds = (value != 0);
+    }
+    else if (type == 'I') {
+      if (record)
+        record->inputs.emplace_back(id, FileTime(value));
+    }
+    else if (type == 'H') {
+      if (record && ! record->inputs.empty() && record->inputs.back().id == id)
+        record->inputs.back().hash = value;
+    }
+  }
+
+  cmdInputsChanged_ = ! (makefilesSame && numMakefiles == makefiles.size() && envSame);
+
+  if (isDebug())
+    std::cerr << "BUILD DB: " << buildRecords_.size() << " records" <<
+                 (cmdInputsChanged_ ? " (command inputs changed)" : "") << "\n";
+
+  return true;
+}
+
+bool
+CMake::
+saveBuildDb()
+{
+  if (! buildDbDirty_ && ! cmdInputsChanged_)
+    return true;
+
+  auto tmpFile = buildDbFile_ + ".tmp";
+
+  {
+  std::ofstream os(tmpFile);
+
+  if (! os) {
+    std::cerr << "Failed to write '" << tmpFile << "'\n";
+    return false;
+  }
+
+  os << "# CMake build db 2\n";
+
+  for (const auto &id : makefiles_)
+    os << "M " << fileStat(id).mtime << " " << symbols_.name(id) << "\n";
+
+  os << "E " << buildDbEnvHash() << " environment\n";
+
+  for (const auto &pr : buildRecords_) {
+    os << "T " << pr.second.cmdHash << " " << symbols_.name(pr.first) << "\n";
+
+    if (pr.second.volatileCmds)
+      os << "V 1 " << symbols_.name(pr.first) << "\n";
+
+    for (const auto &input : pr.second.inputs) {
+      const auto &name = symbols_.name(input.id);
+
+      os << "I " << input.mtime << " " << name << "\n";
+
+      if (input.hash)
+        os << "H " << input.hash << " " << name << "\n";
+    }
+  }
+  }
+
+  if (::rename(tmpFile.c_str(), buildDbFile_.c_str()) != 0) {
+    std::cerr << "Failed to write '" << buildDbFile_ << "'\n";
+    return false;
+  }
+
+  buildDbDirty_ = false;
+
+  return true;
+}
+
+// hash of environment and command line variables (inputs of command expansion
+// other than the makefiles)
+uint64_t
+CMake::
+buildDbEnvHash() const
+{
+  std::vector<std::string> cmdVars;
+
+  for (const auto &pv : variables_) {
+    if (pv.second->cmdLine)
+      cmdVars.push_back("\n" + pv.second->name + "=" + pv.second->value);
+  }
+
+  std::vector<std::string_view> strs;
+
+  for (char **e = environ; e && *e; ++e)
+    strs.emplace_back(*e);
+
+  for (const auto &str : cmdVars)
+    strs.emplace_back(str);
+
+  return hashStrings(std::move(strs));
+}
+
+//---
+
+// Binary writer/reader for parse cache
+class CMakeCacheWriter {
+ public:
+  CMakeCacheWriter() { }
+
+  void writeU8(uint8_t i) { buffer_ += char(i); }
+
+  void writeU32(uint32_t i) { buffer_.append(reinterpret_cast<const char *>(&i), sizeof(i)); }
+  void writeU64(uint64_t i) { buffer_.append(reinterpret_cast<const char *>(&i), sizeof(i)); }
+
+  void writeString(const std::string &str) {
+    writeU32(uint32_t(str.size()));
+
+    buffer_ += str;
+  }
+
+  bool save(const std::string &filename) const {
+    auto tmpFile = filename + ".tmp";
+
+    {
+    std::ofstream os(tmpFile, std::ios::binary);
+
+    if (! os)
+      return false;
+
+    os.write(buffer_.data(), std::streamsize(buffer_.size()));
+
+    if (! os)
+      return false;
+    }
+
+    return (::rename(tmpFile.c_str(), filename.c_str()) == 0);
+  }
+
+ private:
+  std::string buffer_;
+};
+
+class CMakeCacheReader {
+ public:
+  CMakeCacheReader() { }
+
+  bool load(const std::string &filename) {
+    std::ifstream is(filename, std::ios::binary);
+
+    if (! is)
+      return false;
+
+    buffer_.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+
+    return true;
+  }
+
+  size_t size() const { return buffer_.size(); }
+
+  bool isValid() const { return valid_; }
+
+  uint8_t readU8() {
+    if (! check(1)) return 0;
+
+    return uint8_t(buffer_[pos_++]);
+  }
+
+  uint32_t readU32() {
+    uint32_t i = 0;
+
+    if (! check(sizeof(i))) return 0;
+
+    memcpy(&i, &buffer_[pos_], sizeof(i)); pos_ += sizeof(i);
+
+    return i;
+  }
+
+  uint64_t readU64() {
+    uint64_t i = 0;
+
+    if (! check(sizeof(i))) return 0;
+
+    memcpy(&i, &buffer_[pos_], sizeof(i)); pos_ += sizeof(i);
+
+    return i;
+  }
+
+  std::string_view readString() {
+    auto len = readU32();
+
+    if (! check(len)) return std::string_view();
+
+    std::string_view str(&buffer_[pos_], len); pos_ += len;
+
+    return str;
+  }
+
+  uint32_t peekU32At(size_t pos) const {
+    uint32_t i = 0;
+
+    if (pos + sizeof(i) <= buffer_.size())
+      memcpy(&i, &buffer_[pos], sizeof(i));
+
+    return i;
+  }
+
+ private:
+  bool check(size_t n) {
+    if (pos_ + n > buffer_.size())
+      valid_ = false;
+
+    return valid_;
+  }
+
+ private:
+  std::string buffer_;
+  size_t      pos_   { 0 };
+  bool        valid_ { true };
+};
+
+// Parse cache (.cmake_cache) stores the parsed state (variables, rules and
+// their commands) so unchanged makefiles are not parsed again. It is valid
+// for the same requested makefile and current directory while every makefile
+// read has the same time (and existence) and every environment variable
+// looked up has the same value (or is still unset). Command line variables
+// are not recorded so the cache is not used when any are given. If parsing
+// ran a .SHELL_CACHE $(shell) the whole environment must also be unchanged
+// as it is passed to the command.
+// It is not saved if parsing ran $(shell) (not listed in .SHELL_CACHE) or
+// $(wildcard) as their results can change.
+//
+// Format (native byte order):
+//   magic, version
+//   request     : makefile, current directory
+//   makefiles   : count, (name, exists, mtime)*
+//   environment : count, (name, exists, value)*, environment hash (or 0)
+//   symbols     : count, name*
+//   variables   : count, (id, value, deferred)*
+//   rules       : count, (id, phony, stem, cmd rule index, share rids,
+//                         num rids, rid*, num oids, oid*,
+//                         num cmds, (cmd, silent, ignore)*)*
+//   groups      : count, (cmd rule index, count, rule index*)*
+//   double colon: count, (rule index, next rule index)*
+//   targets     : count, (id, rule index)*
+//   patterns    : count, rule index*
+//   suffixes    : count, suffix*
+//   default rule index, low resolution time ids
+//   shell cache : count, program*, all
+//   vpaths      : count, (pattern, count, dir*)*
+//   exports     : count, (id, exported)*, export all
+//   scan        : scan includes, count, suffix*
+//   end magic
+
+static const uint32_t CMakeCacheMagic   = 0x434d4b43; // CMKC
+static const uint32_t CMakeCacheVersion = 12;
+
+// current directory ("" if unknown)
+static std::string
+CMakeCurrentDir()
+{
+  char buffer[PATH_MAX];
+
+  if (! ::getcwd(buffer, sizeof(buffer)))
+    return "";
+
+  return buffer;
+}
+
+bool
+CMake::
+loadParseCache(const std::string &filename, const std::string &makefile)
+{
+  // only load into empty state
+  if (symbols_.size() || ! variables_.empty() || ! rules_.empty())
+    return false;
+
+  CMakeCacheReader reader;
+
+  if (! reader.load(filename))
+    return false;
+
+  // check header and end marker (file completely written)
+  if (reader.size() < 12 || reader.readU32() != CMakeCacheMagic ||
+      reader.readU32() != CMakeCacheVersion ||
+      reader.peekU32At(reader.size() - 4) != CMakeCacheMagic)
+    return false;
+
+  // check same makefile requested from same directory
+  if (reader.readString() != makefile || reader.readString() != CMakeCurrentDir())
+    return false;
+
+  // check makefiles unchanged
+  auto numMakefiles = reader.readU32();
+
+  std::vector<std::string> makefiles;
+
+  for (uint32_t i = 0; i < numMakefiles && reader.isValid(); ++i) {
+    std::string name(reader.readString());
+
+    bool     exists = reader.readU8();
+    FileTime mtime  = FileTime(reader.readU64());
+
+    struct stat sb;
+
+    bool exists1 = (::stat(name.c_str(), &sb) == 0);
+
+    if (exists1 != exists)
+      return false;
+
+    FileTime mtime1 = CMakeStatTime(sb);
+
+    if (exists && mtime1 != mtime)
+      return false;
+
+    makefiles.push_back(name);
+  }
+
+  // check environment variables unchanged (and unset variables still unset)
+  auto numEnv = reader.readU32();
+
+  for (uint32_t i = 0; i < numEnv && reader.isValid(); ++i) {
+    std::string name (reader.readString());
+    bool        exists = reader.readU8();
+    auto        value  = reader.readString();
+
+    auto ptr = getenv(name.c_str());
+
+    if ((ptr != nullptr) != exists || (ptr && value != ptr))
+      return false;
+  }
+
+  // check environment of cached $(shell) commands unchanged
+  auto envHash = reader.readU64();
+
+  if (envHash != 0 && envHash != environHash())
+    return false;
+
+  if (! reader.isValid())
+    return false;
+
+  if (isDebug())
+    std::cerr << "LOAD PARSE CACHE: " << filename << "\n";
+
+  //---
+
+  // symbols (same ids as when saved as table is empty)
+  auto numSymbols = reader.readU32();
+
+  for (uint32_t i = 0; i < numSymbols; ++i)
+    symbols_.intern(reader.readString());
+
+  for (const auto &name : makefiles)
+    makefiles_.push_back(symbols_.intern(name));
+
+  // variables
+  auto numVariables = reader.readU32();
+
+  for (uint32_t i = 0; i < numVariables && reader.isValid(); ++i) {
+    auto id       = reader.readU32();
+    auto value    = std::string(reader.readString());
+    bool deferred = reader.readU8();
+    bool env      = reader.readU8();
+
+    auto *var = defineVariable(symbols_.name(id), value, deferred);
+
+    var->env = env;
+  }
+
+  // rules (command rules are always before the rules which use them)
+  auto numRules = reader.readU32();
+
+  RuleArray ruleList;
+
+  auto indexRule = [&](uint32_t ind) {
+    return (ind < ruleList.size() ? ruleList[ind] : nullptr);
+  };
+
+  for (uint32_t i = 0; i < numRules && reader.isValid(); ++i) {
+    auto id    = reader.readU32();
+    bool phony = reader.readU8();
+    auto stem  = std::string(reader.readString());
+
+    auto *cmdRule   = indexRule(reader.readU32());
+    bool  shareRids = reader.readU8();
+
+    auto numRids = reader.readU32();
+
+    SymbolIds rids;
+
+    for (uint32_t j = 0; j < numRids && reader.isValid(); ++j)
+      rids.push_back(reader.readU32());
+
+    auto numOids = reader.readU32();
+
+    SymbolIds oids;
+
+    for (uint32_t j = 0; j < numOids && reader.isValid(); ++j)
+      oids.push_back(reader.readU32());
+
+    auto *rule = arena_.create<Rule>(&symbols_, id, rids);
+
+    rule->addOids(oids);
+
+    rule->setPhony  (phony);
+    rule->setStem   (stem);
+    rule->setCmdRule(cmdRule, shareRids);
+
+    auto numCmds = reader.readU32();
+
+    for (uint32_t j = 0; j < numCmds && reader.isValid(); ++j) {
+      auto &cmd = rule->addCmd(std::string(reader.readString()));
+
+      cmd.setSilent(reader.readU8());
+      cmd.setIgnore(reader.readU8());
+    }
+
+    ruleList.push_back(rule);
+  }
+
+  // grouped targets
+  auto numGroups = reader.readU32();
+
+  for (uint32_t i = 0; i < numGroups && reader.isValid(); ++i) {
+    auto *cmdRule = indexRule(reader.readU32());
+
+    auto numGroupRules = reader.readU32();
+
+    for (uint32_t j = 0; j < numGroupRules && reader.isValid(); ++j) {
+      auto *rule = indexRule(reader.readU32());
+
+      if (cmdRule && rule)
+        cmdRule->addGroupRule(rule);
+    }
+  }
+
+  // double colon rules
+  auto numDoubleColon = reader.readU32();
+
+  for (uint32_t i = 0; i < numDoubleColon && reader.isValid(); ++i) {
+    auto *rule     = indexRule(reader.readU32());
+    auto *nextRule = indexRule(reader.readU32());
+
+    if (rule) {
+      rule->setDoubleColon(true);
+      rule->setNextColon  (nextRule);
+    }
+  }
+
+  // targets
+  auto numTargets = reader.readU32();
+
+  for (uint32_t i = 0; i < numTargets && reader.isValid(); ++i) {
+    auto id   = reader.readU32();
+    auto *rule = indexRule(reader.readU32());
+
+    if (rule)
+      rules_[id] = rule;
+  }
+
+  // pattern rules
+  auto numPatterns = reader.readU32();
+
+  for (uint32_t i = 0; i < numPatterns && reader.isValid(); ++i) {
+    auto *rule = indexRule(reader.readU32());
+
+    if (rule)
+      patternRules_.add(rule, rule->lhs());
+  }
+
+  // suffixes (replace defaults only when cache is valid)
+  auto numSuffixes = reader.readU32();
+
+  std::vector<std::string> suffixes;
+
+  for (uint32_t i = 0; i < numSuffixes && reader.isValid(); ++i)
+    suffixes.push_back(std::string(reader.readString()));
+
+  // default rule
+  defRule_ = indexRule(reader.readU32());
+
+  // low resolution time files
+  auto numLowRes = reader.readU32();
+
+  for (uint32_t i = 0; i < numLowRes && reader.isValid(); ++i)
+    lowResTimeFiles_.insert(reader.readU32());
+
+  // pure shell programs
+  auto numShellProgs = reader.readU32();
+
+  for (uint32_t i = 0; i < numShellProgs && reader.isValid(); ++i)
+    shellProgs_.insert(std::string(reader.readString()));
+
+  shellCacheAll_ = (reader.readU32() != 0);
+
+  // vpaths
+  auto numVPaths = reader.readU32();
+
+  for (uint32_t i = 0; i < numVPaths && reader.isValid(); ++i) {
+    VPath vpath;
+
+    vpath.pattern = reader.readString();
+
+    auto numDirs = reader.readU32();
+
+    for (uint32_t j = 0; j < numDirs && reader.isValid(); ++j)
+      vpath.dirs.push_back(std::string(reader.readString()));
+
+    vpaths_.push_back(std::move(vpath));
+  }
+
+  // exported/unexported variables
+  auto numExports = reader.readU32();
+
+  for (uint32_t i = 0; i < numExports && reader.isValid(); ++i) {
+    auto id = reader.readU32();
+
+    exports_[id] = (reader.readU8() != 0);
+  }
+
+  exportAll_ = (reader.readU32() != 0);
+
+  // include scan suffixes
+  scanIncludes_ = (reader.readU32() != 0);
+
+  auto numScanSuffixes = reader.readU32();
+
+  for (uint32_t i = 0; i < numScanSuffixes && reader.isValid(); ++i)
+    scanSuffixes_.insert(std::string(reader.readString()));
+
+  if (! reader.isValid() || reader.readU32() != CMakeCacheMagic) {
+    std::cerr << "Invalid parse cache '" << filename << "'\n";
+
+    // back to empty state so makefiles are parsed from scratch (rules already
+    // created are left in the arena)
+    symbols_       = Symbols();
+    variables_.clear();
+    rules_.clear();
+    defRule_       = nullptr;
+    lowResTimeFiles_.clear();
+    patternRules_  = PatternIndex();
+    shellProgs_.clear();
+    shellCacheAll_ = false;
+    vpaths_.clear();
+    exports_.clear();
+    exportAll_     = false;
+    scanIncludes_  = false;
+    scanSuffixes_.clear();
+    makefiles_.clear();
+    envDirty_      = true;
+
+    return false;
+  }
+
+  suffixes_ = std::move(suffixes);
+
+  return true;
+}
+
+bool
+CMake::
+saveParseCache(const std::string &filename, const std::string &makefile)
+{
+  // parse used $(shell) (not in .SHELL_CACHE) or $(wildcard) so remove any
+  // previous cache instead of saving results which may change
+  if (volatileCalls_ > 0) {
+    if (isDebug())
+      std::cerr << "PARSE NOT CACHED ($(shell) or $(wildcard) used)\n";
+
+    ::unlink(filename.c_str());
+
+    return true;
+  }
+
+  CMakeCacheWriter writer;
+
+  writer.writeU32(CMakeCacheMagic);
+  writer.writeU32(CMakeCacheVersion);
+
+  // request
+  writer.writeString(makefile);
+  writer.writeString(CMakeCurrentDir());
+
+  // makefiles
+  writer.writeU32(uint32_t(makefiles_.size()));
+
+  for (const auto &id : makefiles_) {
+    auto fstat = fileStat(id);
+
+    writer.writeString(symbols_.name(id));
+    writer.writeU8    (fstat.exists);
+    writer.writeU64   (uint64_t(fstat.mtime));
+  }
+
+  // environment variables looked up
+  writer.writeU32(uint32_t(envLookups_.size()));
+
+  for (const auto &pe : envLookups_) {
+    writer.writeString(pe.first);
+    writer.writeU8    (pe.second.exists);
+    writer.writeString(pe.second.value);
+  }
+
+  writer.writeU64(parsePureShell_ ? environHash() : 0);
+
+  // symbols
+  writer.writeU32(uint32_t(symbols_.size()));
+
+  for (size_t i = 0; i < symbols_.size(); ++i)
+    writer.writeString(symbols_.name(SymbolId(i)));
+
+  // variables
+  writer.writeU32(uint32_t(variables_.size()));
+
+  for (const auto &pv : variables_) {
+    writer.writeU32   (pv.first);
+    writer.writeString(pv.second->value);
+    writer.writeU8    (pv.second->deferred);
+    writer.writeU8    (pv.second->env);
+  }
+
+  // rules (targets, command rules and pattern rules)
+  RuleArray ruleList;
+
+  std::unordered_map<const Rule *,uint32_t> ruleInd;
+
+  std::function<void (Rule *)> addRule = [&](Rule *rule) {
+    if (! rule || ruleInd.find(rule) != ruleInd.end())
+      return;
+
+    addRule(rule->cmdRule());
+
+    ruleInd[rule] = uint32_t(ruleList.size());
+
+    ruleList.push_back(rule);
+
+    addRule(rule->nextColon());
+  };
+
+  for (const auto &pr : rules_)
+    addRule(pr.second);
+
+  for (auto *rule : patternRules_.rules())
+    addRule(rule);
+
+  auto ruleIndex = [&](const Rule *rule) {
+    return (rule ? ruleInd[rule] : NO_SYMBOL);
+  };
+
+  writer.writeU32(uint32_t(ruleList.size()));
+
+  for (auto *rule : ruleList) {
+    writer.writeU32   (rule->lhsId());
+    writer.writeU8    (rule->isPhony());
+    writer.writeString(rule->stem());
+    writer.writeU32   (ruleIndex(rule->cmdRule()));
+    writer.writeU8    (rule->isShareRids());
+
+    // shared prerequisites are stored on command rule
+    if (! rule->isShareRids()) {
+      writer.writeU32(uint32_t(rule->rids().size()));
+
+      for (const auto &rid : rule->rids())
+        writer.writeU32(rid);
+
+      writer.writeU32(uint32_t(rule->oids().size()));
+
+      for (const auto &oid : rule->oids())
+        writer.writeU32(oid);
+    }
+    else {
+      writer.writeU32(0);
+      writer.writeU32(0);
+    }
+
+    // own commands (shared commands are stored on command rule)
+    if (! rule->cmdRule()) {
+      writer.writeU32(uint32_t(rule->cmds().size()));
+
+      for (const auto &cmd : rule->cmds()) {
+        writer.writeString(cmd.cmd());
+        writer.writeU8    (cmd.isSilent());
+        writer.writeU8    (cmd.isIgnore());
+      }
+    }
+    else
+      writer.writeU32(0);
+  }
+
+  // grouped targets (rules not in list were redefined)
+  RuleArray groupRules;
+
+  for (auto *rule : ruleList) {
+    if (! rule->groupRules().empty())
+      groupRules.push_back(rule);
+  }
+
+  writer.writeU32(uint32_t(groupRules.size()));
+
+  for (auto *rule : groupRules) {
+    writer.writeU32(ruleIndex(rule));
+
+    RuleArray group;
+
+    for (auto *rule1 : rule->groupRules()) {
+      if (ruleInd.find(rule1) != ruleInd.end())
+        group.push_back(rule1);
+    }
+
+    writer.writeU32(uint32_t(group.size()));
+
+    for (auto *rule1 : group)
+      writer.writeU32(ruleIndex(rule1));
+  }
+
+  // double colon rules
+  RuleArray doubleColonRules;
+
+  for (auto *rule : ruleList) {
+    if (rule->isDoubleColon())
+      doubleColonRules.push_back(rule);
+  }
+
+  writer.writeU32(uint32_t(doubleColonRules.size()));
+
+  for (auto *rule : doubleColonRules) {
+    writer.writeU32(ruleIndex(rule));
+    writer.writeU32(ruleIndex(rule->nextColon()));
+  }
+
+  // targets
+  writer.writeU32(uint32_t(rules_.size()));
+
+  for (const auto &pr : rules_) {
+    writer.writeU32(pr.first);
+    writer.writeU32(ruleIndex(pr.second));
+  }
+
+  // pattern rules
+  writer.writeU32(uint32_t(patternRules_.rules().size()));
+
+  for (auto *rule : patternRules_.rules())
+    writer.writeU32(ruleIndex(rule));
+
+  // suffixes
+  writer.writeU32(uint32_t(suffixes_.size()));
+
+  for (const auto &suffix : suffixes_)
+    writer.writeString(suffix);
+
+  writer.writeU32(ruleIndex(defRule_));
+
+  writer.writeU32(uint32_t(lowResTimeFiles_.size()));
+
+  for (const auto &id : lowResTimeFiles_)
+    writer.writeU32(id);
+
+  writer.writeU32(uint32_t(shellProgs_.size()));
+
+  for (const auto &prog : shellProgs_)
+    writer.writeString(prog);
+
+  writer.writeU32(shellCacheAll_ ? 1 : 0);
+
+  writer.writeU32(uint32_t(vpaths_.size()));
+
+  for (const auto &vpath : vpaths_) {
+    writer.writeString(vpath.pattern);
+
+    writer.writeU32(uint32_t(vpath.dirs.size()));
+
+    for (const auto &dir : vpath.dirs)
+      writer.writeString(dir);
+  }
+
+  writer.writeU32(uint32_t(exports_.size()));
+
+  for (const auto &pe : exports_) {
+    writer.writeU32(pe.first);
+    writer.writeU8 (pe.second);
+  }
+
+  writer.writeU32(exportAll_ ? 1 : 0);
+
+  writer.writeU32(scanIncludes_ ? 1 : 0);
+
+  writer.writeU32(uint32_t(scanSuffixes_.size()));
+
+  for (const auto &suffix : scanSuffixes_)
+    writer.writeString(suffix);
+
+  writer.writeU32(CMakeCacheMagic);
+
+  if (! writer.save(filename)) {
+    std::cerr << "Failed to write '" << filename << "'\n";
+    return false;
+  }
+
+  return true;
+}
+
+bool
+CMake::
+buildDbOutOfDate(Rule *rule)
+{
+  auto p = buildRecords_.find(rule->lhsId());
+
+  // no record so record current state (built by times)
+  if (p == buildRecords_.end()) {
+    ExecCmds execCmds;
+
+    expandCmds(rule, execCmds);
+
+    updateBuildRecord(rule, execCmds);
+
+    return false;
+  }
+
+  auto &record = (*p).second;
+
+  // prerequisites changed since last build
+  if (inputsChanged(rule, record)) {
+    if (isDebug())
+      std::cerr << "INPUTS CHANGED : " << rule->lhs() << "\n";
+
+    return true;
+  }
+
+  // commands can only have changed if their inputs did (or their expansion
+  // can differ between runs)
+  if (! cmdInputsChanged_ && ! record.volatileCmds)
+    return false;
+
+  ExecCmds execCmds;
+
+  expandCmds(rule, execCmds);
+
+  if (hashCmds(execCmds) != record.cmdHash) {
+    if (isDebug())
+      std::cerr << "COMMAND CHANGED : " << rule->lhs() << "\n";
+
+    // reused by build
+    if (rule->groupLeader() == rule)
+      expandedCmds_[rule] = std::move(execCmds);
+
+    return true;
+  }
+
+  return false;
+}
+
+// check if inputs of rule differ from record (added, removed or new time). In
+// content hash mode an input with a new time is unchanged if its hash is the
+// same (recorded time is updated so it is not hashed again).
+bool
+CMake::
+inputsChanged(Rule *rule, BuildRecord &record)
+{
+  SymbolIds ids;
+
+  ruleInputs(rule, ids);
+
+  if (record.inputs.size() != ids.size())
+    return true;
+
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto &input = record.inputs[i];
+
+    if (input.id != ids[i])
+      return true;
+
+    auto id = vpathFile(ids[i]);
+
+    auto mtime = fileStat(id).mtime;
+
+    if (mtime == input.mtime)
+      continue;
+
+    if (! isContentHash() || ! input.hash || fileHash(id) != input.hash)
+      return true;
+
+    if (isDebug())
+      std::cerr << "SAME CONTENTS : " << symbols_.name(id) << "\n";
+
+    input.mtime = mtime;
+
+    buildDbDirty_ = true;
+  }
+
+  return false;
+}
+
+// check target exists and its recorded inputs have the same contents
+bool
+CMake::
+inputsUnchanged(Rule *rule)
+{
+  auto p = buildRecords_.find(rule->lhsId());
+
+  if (p == buildRecords_.end() || ! fileStat(rule->lhsId()).exists)
+    return false;
+
+  return ! inputsChanged(rule, (*p).second);
+}
+
+void
+CMake::
+updateBuildRecord(Rule *rule, const ExecCmds &execCmds)
+{
+  auto &record = buildRecords_[rule->lhsId()];
+
+  record.cmdHash      = hashCmds(execCmds);
+  record.volatileCmds = (volatileCmds_.find(rule) != volatileCmds_.end() ||
+                         volatileCmds_.find(rule->groupLeader()) != volatileCmds_.end());
+
+  // reuse hashes of inputs with unchanged times
+  BuildRecord::Inputs oldInputs;
+
+  std::swap(oldInputs, record.inputs);
+
+  SymbolIds ids;
+
+  ruleInputs(rule, ids);
+
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto id = vpathFile(ids[i]);
+
+    auto mtime = fileStat(id).mtime;
+
+    uint64_t hash = 0;
+
+    if (isContentHash()) {
+      if (i < oldInputs.size() && oldInputs[i].id == ids[i] && oldInputs[i].mtime == mtime)
+        hash = oldInputs[i].hash;
+
+      if (! hash)
+        hash = fileHash(id);
+    }
+
+    record.inputs.emplace_back(ids[i], mtime, hash);
+  }
+
+  buildDbDirty_ = true;
+}
+
+bool
+CMake::
+runCmds(const ExecCmds &execCmds)
+{
+  // recipe lines of a rule are always run in order
+  for (const auto &execCmd : execCmds) {
+    if (! exec(execCmd.cmd, commandEnvp(execCmd.env), execCmd.silent) && ! execCmd.ignore)
+      return false;
+  }
+
+  return true;
+}
+
+bool
+CMake::
+outOfDate(SymbolId lhs, const SymbolIds &rids) const
+{
+  if (isDebug()) {
+    std::cerr << "CHECK OUT OF DATE: " << symbols_.name(lhs);
+
+    for (const auto &rid : rids)
+      std::cerr << " " << symbols_.name(rid);
+
+    std::cerr << "\n";
+  }
+
+  // if rhs files don't exist then need build
+  FileTime rtime = 0;
+
+  for (const auto &rid : rids) {
+    auto rstat = fileStat(vpathFile(rid));
+
+    if (! rstat.exists) {
+      if (isDebug())
+        std::cerr << "NOT EXIST : " << symbols_.name(rid) << "\n";
+
+      return true;
+    }
+
+    rtime = std::max(rtime, rstat.mtime);
+  }
+
+  // if lhs file doesn't exist then need build
+  auto lstat = fileStat(lhs);
+
+  if (! lstat.exists) {
+    if (isDebug())
+      std::cerr << "NOT EXIST : " << symbols_.name(lhs) << "\n";
+
+    return true;
+  }
+
+  // if any file on rhs is newer than lhs then need build
+  // (lhs created with low resolution time only compares whole seconds)
+  FileTime ltime = lstat.mtime;
+
+  if (isLowResolutionTime(lhs)) {
+    const FileTime ns = 1000000000;
+
+    ltime = (ltime/ns)*ns;
+    rtime = (rtime/ns)*ns;
+  }
+
+  if (ltime < rtime) {
+    if (isDebug()) {
+      for (const auto &rid : rids) {
+        if (fileStat(vpathFile(rid)).mtime > ltime)
+          std::cerr << "NEWER : " << symbols_.name(rid) << "\n";
+      }
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+// directory part of path ("." if none)
+static std::string_view
+CMakeDirName(std::string_view path)
+{
+  auto pos = path.rfind('/');
+
+  if (pos == std::string_view::npos)
+    return ".";
+
+  if (pos == 0)
+    return "/";
+
+  return path.substr(0, pos);
+}
+
+// file part of path
+static std::string_view
+CMakeBaseName(std::string_view path)
+{
+  auto pos = path.rfind('/');
+
+  return (pos != std::string_view::npos ? path.substr(pos + 1) : path);
+}
+
+static std::string
+CMakeJoinPath(std::string_view dir, std::string_view name)
+{
+  std::string path(dir);
+
+  if (! path.empty() && path.back() != '/')
+    path += '/';
+
+  path.append(name.data(), name.size());
+
+  return path;
+}
+
+// iterate over space separated words of string
+template<typename FUNC>
+static void
+CMakeForEachWord(std::string_view str, FUNC func)
+{
+  const char *p  = str.data();
+  const char *pe = p + str.size();
+
+  while (true) {
+    while (p < pe && isspace(static_cast<unsigned char>(*p)))
+      ++p;
+
+    if (p >= pe)
+      break;
+
+    const char *p1 = p;
+
+    while (p < pe && ! isspace(static_cast<unsigned char>(*p)))
+      ++p;
+
+    func(std::string_view(p1, size_t(p - p1)));
+  }
+}
+
+// match word to pattern (prefix%suffix, % at pos) and return stem
+static bool
+CMakeMatchPattern(std::string_view pattern, size_t pos, std::string_view word,
+                  std::string_view &stem)
+{
+  if (pos == std::string_view::npos) {
+    stem = std::string_view();
+
+    return (word == pattern);
+  }
+
+  auto prefix = pattern.substr(0, pos);
+  auto suffix = pattern.substr(pos + 1);
+
+  if (word.size() < prefix.size() + suffix.size())
+    return false;
+
+  if (word.compare(0, prefix.size(), prefix) != 0 ||
+      word.compare(word.size() - suffix.size(), suffix.size(), suffix) != 0)
+    return false;
+
+  stem = word.substr(prefix.size(), word.size() - prefix.size() - suffix.size());
+
+  return true;
+}
+
+//---
+
+// Include scanner (.SCAN_INCLUDES) adds the #include files of C/C++
+// prerequisites (and the files they include) to the out of date check of
+// rules with commands. Includes are resolved against the including file's
+// directory (quoted only) and the -I, -iquote and -isystem directories of the
+// rule's expanded commands; unresolved includes (system headers) are
+// ignored. Preprocessor conditionals are not evaluated so the dependencies
+// may be a superset.
+//
+// The #include lines of each file are stored with the file time in the
+// include cache (.cmake_includes) so unchanged files are not read again.
+//
+// Format (native byte order):
+//   magic, version
+//   files : count, (name, mtime, count, (include, angle)*)*
+//   end magic
+
+static const uint32_t CMakeIncludeMagic   = 0x434d4b49; // CMKI
+static const uint32_t CMakeIncludeVersion = 1;
+
+// read #include lines of file
+static void
+CMakeReadIncludes(const std::string &filename, std::vector<std::pair<std::string,bool>> &includes)
+{
+  CMakeLineReader reader;
+
+  if (! reader.open(filename))
+    return;
+
+  std::string_view line;
+
+  while (reader.nextLine(line)) {
+    auto len = line.size();
+
+    size_t i = 0;
+
+    while (i < len && (line[i] == ' ' || line[i] == '\t'))
+      ++i;
+
+    if (i >= len || line[i] != '#')
+      continue;
+
+    ++i;
+
+    while (i < len && (line[i] == ' ' || line[i] == '\t'))
+      ++i;
+
+    if (line.substr(i, 7) != "include")
+      continue;
+
+    i += 7;
+
+    while (i < len && (line[i] == ' ' || line[i] == '\t'))
+      ++i;
+
+    if (i >= len || (line[i] != '"' && line[i] != '<'))
+      continue;
+
+    bool angle = (line[i] == '<');
+
+    auto pos = line.find(angle ? '>' : '"', i + 1);
+
+    if (pos == std::string_view::npos || pos == i + 1)
+      continue;
+
+    includes.emplace_back(std::string(line.substr(i + 1, pos - i - 1)), angle);
+  }
+}
+
+bool
+CMake::
+isScanFile(SymbolId id) const
+{
+  const auto &name = symbols_.name(id);
+
+  auto pos = name.rfind('.');
+
+  if (pos == std::string::npos || name.find('/', pos) != std::string::npos)
+    return false;
+
+  return (scanSuffixes_.find(name.substr(pos)) != scanSuffixes_.end());
+}
+
+// get #includes of file (rescanned if time changed)
+const CMake::Includes &
+CMake::
+fileIncludes(SymbolId id)
+{
+  if (! includeCacheLoaded_)
+    loadIncludeCache();
+
+  auto mtime = fileStat(id).mtime;
+
+  auto p = includeScans_.find(id);
+
+  if (p != includeScans_.end() && (*p).second.mtime == mtime)
+    return (*p).second.includes;
+
+  auto &scan = includeScans_[id];
+
+  scan.mtime = mtime;
+
+  scan.includes.clear();
+
+  std::vector<std::pair<std::string,bool>> includes;
+
+  CMakeReadIncludes(symbols_.name(id), includes);
+
+  for (auto &include : includes)
+    scan.includes.push_back(Include { std::move(include.first), include.second });
+
+  if (isDebug())
+    std::cerr << "SCAN INCLUDES: " << symbols_.name(id) << " (" <<
+                 scan.includes.size() << ")\n";
+
+  // resolved includes of file are stale
+  for (auto &pd : dirsIncludes_)
+    pd.second.erase(id);
+
+  includeCacheDirty_ = true;
+
+  return scan.includes;
+}
+
+void
+CMake::
+loadIncludeCache()
+{
+  includeCacheLoaded_ = true;
+
+  if (includeCacheFile_.empty())
+    return;
+
+  CMakeCacheReader reader;
+
+  if (! reader.load(includeCacheFile_))
+    return;
+
+  if (reader.size() < 12 || reader.readU32() != CMakeIncludeMagic ||
+      reader.readU32() != CMakeIncludeVersion ||
+      reader.peekU32At(reader.size() - 4) != CMakeIncludeMagic)
+    return;
+
+  auto numFiles = reader.readU32();
+
+  for (uint32_t i = 0; i < numFiles && reader.isValid(); ++i) {
+    auto id = symbols_.intern(reader.readString());
+
+    auto &scan = includeScans_[id];
+
+    scan.mtime = FileTime(reader.readU64());
+
+    auto numIncludes = reader.readU32();
+
+    for (uint32_t j = 0; j < numIncludes && reader.isValid(); ++j) {
+      Include include;
+
+      include.name  = reader.readString();
+      include.angle = (reader.readU8() != 0);
+
+      scan.includes.push_back(std::move(include));
+    }
+  }
+
+  if (! reader.isValid()) {
+    includeScans_.clear();
+    return;
+  }
+
+  if (isDebug())
+    std::cerr << "LOAD INCLUDE CACHE: " << includeScans_.size() << " files\n";
+}
+
+bool
+CMake::
+saveIncludeCache()
+{
+  if (! includeCacheDirty_ || includeCacheFile_.empty())
+    return true;
+
+  CMakeCacheWriter writer;
+
+  writer.writeU32(CMakeIncludeMagic);
+  writer.writeU32(CMakeIncludeVersion);
+
+  writer.writeU32(uint32_t(includeScans_.size()));
+
+  for (const auto &ps : includeScans_) {
+    writer.writeString(symbols_.name(ps.first));
+    writer.writeU64   (uint64_t(ps.second.mtime));
+
+    writer.writeU32(uint32_t(ps.second.includes.size()));
+
+    for (const auto &include : ps.second.includes) {
+      writer.writeString(include.name);
+      writer.writeU8    (include.angle);
+    }
+  }
+
+  writer.writeU32(CMakeIncludeMagic);
+
+  if (! writer.save(includeCacheFile_)) {
+    std::cerr << "Failed to write '" << includeCacheFile_ << "'\n";
+    return false;
+  }
+
+  includeCacheDirty_ = false;
+
+  return true;
+}
+
+// check if command text references automatic variables ($@, $(<D), ...)
+static bool
+CMakeHasAutoVars(const std::string &str)
+{
+  static const char *autoChars = "@<*^+?|";
+
+  for (size_t i = 0; i + 1 < str.size(); ++i) {
+    if (str[i] != '$')
+      continue;
+
+    char c = str[i + 1];
+
+    if ((c == '(' || c == '{') && i + 2 < str.size())
+      c = str[i + 2];
+
+    if (c && strchr(autoChars, c))
+      return true;
+
+    ++i; // skip $$
+  }
+
+  return false;
+}
+
+// include directories (-Idir, -I dir, -iquote dir, -isystem dir) of rule's commands.
+// Commands are only expanded once per command rule (per target if they use
+// automatic variables) as expansion can run $(shell)
+const CMake::IncludeDirs &
+CMake::
+ruleIncludeDirs(Rule *rule) const
+{
+  const Rule *keyRule = rule;
+
+  if (rule->cmdRule()) {
+    bool autoVars = false;
+
+    for (const auto &cmd : rule->cmds()) {
+      if (CMakeHasAutoVars(cmd.cmd()))
+        autoVars = true;
+    }
+
+    if (! autoVars)
+      keyRule = rule->cmdRule();
+  }
+
+  auto p = ruleIncludeDirs_.find(keyRule);
+
+  if (p != ruleIncludeDirs_.end())
+    return (*p).second;
+
+  auto &dirs = ruleIncludeDirs_[keyRule];
+
+  ExecCmds execCmds;
+
+  expandCmds(rule, execCmds);
+
+  for (const auto &execCmd : execCmds) {
+    bool next = false;
+
+    CMakeForEachWord(execCmd.cmd, [&](std::string_view word) {
+      if      (next) {
+        dirs.emplace_back(word);
+
+        next = false;
+      }
+      else if (word == "-I" || word == "-iquote" || word == "-isystem" || word == "-idirafter")
+        next = true;
+      else if (word.size() > 2 && word[0] == '-' && word[1] == 'I')
+        dirs.emplace_back(word.substr(2));
+    });
+  }
+
+  return dirs;
+}
+
+// find included file (NO_SYMBOL if not found). A file which does not exist yet
+// is found if it is the target of a rule (generated header)
+CMake::SymbolId
+CMake::
+resolveInclude(SymbolId from, const Include &include, const IncludeDirs &dirs)
+{
+  auto findFile = [&](std::string_view dir) {
+    auto id = symbols_.intern(dir == "." ? std::string(include.name) :
+                                           CMakeJoinPath(dir, include.name));
+
+    if (fileStat(id).exists || rules_.find(id) != rules_.end())
+      return id;
+
+    return NO_SYMBOL;
+  };
+
+  if (! include.name.empty() && include.name[0] == '/')
+    return findFile(".");
+
+  if (! include.angle) {
+    auto id = findFile(CMakeDirName(symbols_.name(from)));
+
+    if (id != NO_SYMBOL)
+      return id;
+  }
+
+  for (const auto &dir : dirs) {
+    auto id = findFile(dir);
+
+    if (id != NO_SYMBOL)
+      return id;
+  }
+
+  return NO_SYMBOL;
+}
+
+// all files included (directly or indirectly) by scanned prerequisites of rule
+void
+CMake::
+includeDeps(Rule *rule, SymbolIds &deps)
+{
+  SymbolIds todo;
+
+  for (const auto &rid : rule->rids()) {
+    if (isScanFile(rid))
+      todo.push_back(vpathFile(rid));
+  }
+
+  if (todo.empty())
+    return;
+
+  const auto &dirs = ruleIncludeDirs(rule);
+
+  // resolved includes are shared by rules with the same include dirs
+  std::string dirsKey;
+
+  for (const auto &dir : dirs) {
+    dirsKey += dir;
+    dirsKey += '\n';
+  }
+
+  auto &resolved = dirsIncludes_[dirsKey];
+
+  FileIds visited(todo.begin(), todo.end());
+
+  while (! todo.empty()) {
+    auto id = todo.back();
+
+    todo.pop_back();
+
+    auto p = resolved.find(id);
+
+    if (p == resolved.end()) {
+      SymbolIds ids;
+
+      for (const auto &include : fileIncludes(id)) {
+        auto id1 = resolveInclude(id, include, dirs);
+
+        if (id1 != NO_SYMBOL)
+          ids.push_back(id1);
+      }
+
+      p = resolved.emplace(id, std::move(ids)).first;
+    }
+
+    for (const auto &id1 : (*p).second) {
+      if (visited.insert(id1).second) {
+        deps.push_back(id1);
+
+        todo.push_back(id1);
+      }
+    }
+  }
+}
+
+// check if any included file is newer than target
+bool
+CMake::
+includesOutOfDate(Rule *rule)
+{
+  if (! rule->hasCmds())
+    return false;
+
+  auto p = ruleIncludes_.find(rule);
+
+  if (p == ruleIncludes_.end()) {
+    SymbolIds deps;
+
+    includeDeps(rule, deps);
+
+    p = ruleIncludes_.emplace(rule, std::move(deps)).first;
+  }
+
+  if ((*p).second.empty())
+    return false;
+
+  return outOfDate(rule->lhsId(), (*p).second);
+}
+
+// scanned includes of rule which are targets of rules (generated headers). These
+// are made before the rule's commands like prerequisites. Only known once the
+// scanned prerequisites (and any generated headers they include) are made.
+void
+CMake::
+ruleGeneratedIncludes(Rule *rule, std::vector<Rule *> &rules)
+{
+  rules.clear();
+
+  if (! isScanIncludes() || ! rule->hasCmds())
+    return;
+
+  SymbolIds deps;
+
+  includeDeps(rule, deps);
+
+  for (const auto &id : deps) {
+    auto p = rules_.find(id);
+
+    if (p != rules_.end())
+      rules.push_back((*p).second);
+  }
+}
+
+// inputs of rule recorded in build database (prerequisites and scanned includes)
+void
+CMake::
+ruleInputs(Rule *rule, SymbolIds &ids)
+{
+  ids = rule->rids();
+
+  if (! isScanIncludes() || ! rule->hasCmds())
+    return;
+
+  auto p = ruleIncludes_.find(rule);
+
+  if (p == ruleIncludes_.end()) {
+    SymbolIds deps;
+
+    includeDeps(rule, deps);
+
+    p = ruleIncludes_.emplace(rule, std::move(deps)).first;
+  }
+
+  ids.insert(ids.end(), (*p).second.begin(), (*p).second.end());
+}
+
+// modification time of stat result in nanoseconds since the epoch
+static int64_t
+CMakeStatTime(const struct stat &sb)
+{
+#ifdef __APPLE__
+  return int64_t(sb.st_mtimespec.tv_sec)*1000000000 + sb.st_mtimespec.tv_nsec;
+#else
+  return int64_t(sb.st_mtim.tv_sec)*1000000000 + sb.st_mtim.tv_nsec;
+#endif
+}
+
+// get cached file existence and modification time (one stat per file per run)
+CMake::FileStat
+CMake::
+fileStat(SymbolId id) const
+{
+  if (id >= fileStats_.size())
+    fileStats_.resize(symbols_.size());
+
+  auto &fstat = fileStats_[id];
+
+  if (fstat.valid)
+    return fstat;
+
+  fstat = FileStat();
+
+  fstat.valid = true;
+
+  // skip stat if directory already scanned and file not in it
+  const auto &name = symbols_.name(id);
+
+  auto pd = dirListings_.find(std::string(CMakeDirName(name)));
+
+  if (pd != dirListings_.end() && ! (*pd).second.contains(CMakeBaseName(name)))
+    return fstat;
+
+  struct stat sb;
+
+  if (::stat(symbols_.name(id).c_str(), &sb) == 0) {
+    fstat.exists = true;
+    fstat.mtime  = CMakeStatTime(sb);
+  }
+
+  return fstat;
+}
+
+// 64 bit hash of data (xxh64 algorithm)
+static uint64_t
+CMakeHash64(const char *data, size_t len)
+{
+  static const uint64_t P1 = 0x9E3779B185EBCA87ULL;
+  static const uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+  static const uint64_t P3 = 0x165667B19E3779F9ULL;
+  static const uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+  static const uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+  auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+
+  auto read64 = [](const char *p) { uint64_t v; memcpy(&v, p, 8); return v; };
+  auto read32 = [](const char *p) { uint32_t v; memcpy(&v, p, 4); return v; };
+
+  auto round = [&](uint64_t acc, uint64_t input) {
+    acc += input*P2; acc = rotl(acc, 31); acc *= P1; return acc;
+  };
+
+  auto merge = [&](uint64_t acc, uint64_t val) {
+    acc ^= round(0, val); return acc*P1 + P4;
+  };
+
+  const char *p  = data;
+  const char *pe = data + len;
+
+  uint64_t h;
+
+  if (len >= 32) {
+    uint64_t v1 = P1 + P2, v2 = P2, v3 = 0, v4 = 0 - P1;
+
+    do {
+      v1 = round(v1, read64(p     ));
+      v2 = round(v2, read64(p +  8));
+      v3 = round(v3, read64(p + 16));
+      v4 = round(v4, read64(p + 24));
+
+      p += 32;
+    } while (pe - p >= 32);
+
+    h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+
+    h = merge(h, v1); h = merge(h, v2); h = merge(h, v3); h = merge(h, v4);
+  }
+  else
+    h = P5;
+
+  h += uint64_t(len);
+
+  for ( ; pe - p >= 8; p += 8) {
+    h ^= round(0, read64(p));
+    h  = rotl(h, 27)*P1 + P4;
+  }
+
+  if (pe - p >= 4) {
+    h ^= uint64_t(read32(p))*P1;
+    h  = rotl(h, 23)*P2 + P3;
+
+    p += 4;
+  }
+
+  for ( ; p < pe; ++p) {
+    h ^= uint64_t(static_cast<unsigned char>(*p))*P5;
+    h  = rotl(h, 11)*P1;
+  }
+
+  h ^= h >> 33; h *= P2;
+  h ^= h >> 29; h *= P3;
+  h ^= h >> 32;
+
+  return h;
+}
+
+// hash contents of file (mapped or read in one block)
+static bool
+CMakeHashFile(const std::string &filename, uint64_t &hash)
+{
+  int fd = ::open(filename.c_str(), O_RDONLY);
+
+  if (fd < 0)
+    return false;
+
+  struct stat sb;
+
+  if (::fstat(fd, &sb) != 0 || ! S_ISREG(sb.st_mode)) {
+    ::close(fd);
+    return false;
+  }
+
+  auto size = size_t(sb.st_size);
+
+  bool rc = true;
+
+  if (size == 0)
+    hash = CMakeHash64("", 0);
+  else {
+    void *addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (addr != MAP_FAILED) {
+      hash = CMakeHash64(static_cast<const char *>(addr), size);
+
+      ::munmap(addr, size);
+    }
+    else {
+      std::string buffer(size, '\0');
+
+      size_t pos = 0;
+
+      while (pos < size) {
+        auto n = ::read(fd, &buffer[pos], size - pos);
+
+        if (n <= 0)
+          break;
+
+        pos += size_t(n);
+      }
+
+      rc = (pos == size);
+
+      if (rc)
+        hash = CMakeHash64(buffer.data(), size);
+    }
+  }
+
+  ::close(fd);
+
+  return rc;
+}
+
+uint64_t
+CMake::
+fileHash(SymbolId id) const
+{
+  if (! fileStat(id).exists)
+    return 0;
+
+  auto &fstat = fileStats_[id];
+
+  if (! fstat.hashed) {
+    fstat.hashed = true;
+
+    uint64_t hash = 0;
+
+    // 0 is reserved for no hash
+    if (CMakeHashFile(symbols_.name(id), hash))
+      fstat.hash = (hash ? hash : 1);
+
+    if (isDebug())
+      std::cerr << "HASH : " << symbols_.name(id) << "\n";
+  }
+
+  return fstat.hash;
+}
+
+bool
+CMake::
+isLowResolutionTime(SymbolId id) const
+{
+  if (lowResTimeFiles_.empty())
+    return false;
+
+  return (lowResTimeFiles_.find(id) != lowResTimeFiles_.end());
+}
+
+//---
+
+// Artifact cache (-artifact-cache <dir>) stores the outputs of rule commands
+// keyed by a hash of the expanded commands, the command environment, the
+// target names and the names and contents of the inputs. The environment
+// part only covers variables exported by the makefiles (or the command line)
+// and the inherited PATH, LD_LIBRARY_PATH, DYLD_LIBRARY_PATH, LANG and LC_ALL
+// so per user variables (HOME, USER, PWD, ...) don't stop sharing the cache
+// between users and machines. When a rule
+// needs building and its key is in the cache the targets are restored
+// (reflink, hard link or copy) instead of running the commands.
+//
+// Each entry is a directory <dir>/<xx>/<key> holding the targets (named by
+// index) and is created by renaming a complete temporary directory. The
+// entry directory time is its last use. Hit/miss counts and the cache size
+// are kept in <dir>/stats and when the size exceeds the maximum the least
+// recently used entries are removed (at the end of the run, under a lock
+// so cache can be shared by concurrent runs).
+//
+// Cache files are read-only and are restored as reflinks or copies. Hard
+// links (-artifact-cache-link) share the cache file so in place writes to a
+// restored target fail instead of changing the cache, and a restored target
+// is unlinked before its own commands are run (read-only files don't protect
+// the cache from commands run as root).
+
+// list directory (no . and ..)
+static void
+CMakeListDir(const std::string &dir, std::vector<std::string> &names)
+{
+  auto *d = ::opendir(dir.c_str());
+
+  if (! d)
+    return;
+
+  struct dirent *e;
+
+  while ((e = ::readdir(d)) != nullptr) {
+    if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0)
+      continue;
+
+    names.push_back(e->d_name);
+  }
+
+  ::closedir(d);
+}
+
+// remove directory of files
+static void
+CMakeRemoveDir(const std::string &dir)
+{
+  std::vector<std::string> names;
+
+  CMakeListDir(dir, names);
+
+  for (const auto &name : names)
+    ::unlink((dir + "/" + name).c_str());
+
+  ::rmdir(dir.c_str());
+}
+
+// copy file to new file with mode using reflink if supported, otherwise copy
+static bool
+CMakeCloneFile(const std::string &src, const std::string &dst, mode_t mode)
+{
+  int sfd = ::open(src.c_str(), O_RDONLY | O_CLOEXEC);
+
+  if (sfd < 0)
+    return false;
+
+  struct stat sb;
+
+  if (::fstat(sfd, &sb) != 0 || ! S_ISREG(sb.st_mode)) {
+    ::close(sfd);
+    return false;
+  }
+
+#ifdef FICLONE
+  int cfd = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+
+  if (cfd >= 0) {
+    bool cloned = (::ioctl(cfd, FICLONE, sfd) == 0 && ::fchmod(cfd, mode) == 0);
+
+    ::close(cfd);
+
+    if (cloned) {
+      ::close(sfd);
+      return true;
+    }
+
+    ::unlink(dst.c_str());
+  }
+#endif
+
+  int dfd = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+  if (dfd < 0) {
+    ::close(sfd);
+    return false;
+  }
+
+  bool rc = (::fchmod(dfd, mode) == 0);
+
+  char buffer[65536];
+
+  while (rc) {
+    auto n = ::read(sfd, buffer, sizeof(buffer));
+
+    if (n <= 0) {
+      rc = (n == 0);
+      break;
+    }
+
+    for (ssize_t pos = 0; pos < n; ) {
+      auto n1 = ::write(dfd, buffer + pos, size_t(n - pos));
+
+      if (n1 <= 0) {
+        rc = false;
+        break;
+      }
+
+      pos += n1;
+    }
+  }
+
+  ::close(sfd);
+
+  if (::close(dfd) != 0)
+    rc = false;
+
+  if (! rc)
+    ::unlink(dst.c_str());
+
+  return rc;
+}
+
+// create directory and parents
+static void
+CMakeMakeDirs(const std::string &dir)
+{
+  for (auto pos = dir.find('/', 1); ; pos = dir.find('/', pos + 1)) {
+    ::mkdir(dir.substr(0, pos).c_str(), 0755);
+
+    if (pos == std::string::npos)
+      break;
+  }
+}
+
+void
+CMake::
+setArtifactCache(const std::string &dir, uint64_t maxSize, bool link)
+{
+  artifactDir_ = dir;
+
+  while (artifactDir_.size() > 1 && artifactDir_.back() == '/')
+    artifactDir_.pop_back();
+
+  artifactMaxSize_ = maxSize;
+  artifactLink_    = link;
+
+  CMakeMakeDirs(artifactDir_ + "/tmp");
+}
+
+// cache key of rule (false if rule can't be cached)
+bool
+CMake::
+artifactKey(Rule *rule, const ExecCmds &execCmds, std::string &key)
+{
+  if (execCmds.empty())
+    return false;
+
+  std::string str;
+
+  const RuleArray targets = (rule->isGrouped() ? rule->group() : RuleArray { rule });
+
+  for (const auto *target : targets) {
+    // double colon rule only creates part of target
+    if (target->isPhony() || target->isDoubleColon())
+      return false;
+
+    str += "T " + target->lhs() + "\n";
+  }
+
+  for (const auto &execCmd : execCmds)
+    str += "C " + execCmd.cmd + "\n";
+
+  char buffer[64];
+
+  snprintf(buffer, sizeof(buffer), "E %016llx\n", (unsigned long long)
+           (execCmds[0].env ? execCmds[0].env->keyHash : 0));
+
+  str += buffer;
+
+  // inputs must all be files (phony prerequisites always run commands)
+  SymbolIds ids;
+
+  ruleInputs(rule, ids);
+
+  for (const auto &id : ids) {
+    auto pr = rules_.find(id);
+
+    if (pr != rules_.end() && (*pr).second->isPhony())
+      return false;
+
+    auto hash = fileHash(vpathFile(id));
+
+    if (! hash)
+      return false;
+
+    snprintf(buffer, sizeof(buffer), " %016llx\n", (unsigned long long) hash);
+
+    str += "I " + symbols_.name(id) + buffer;
+  }
+
+  snprintf(buffer, sizeof(buffer), "%016llx%016llx",
+           (unsigned long long) CMakeHash64(str.data(), str.size()),
+           (unsigned long long) hashString(str));
+
+  key = buffer;
+
+  return true;
+}
+
+std::string
+CMake::
+artifactEntry(const std::string &key) const
+{
+  return artifactDir_ + "/" + key.substr(0, 2) + "/" + key;
+}
+
+// restore targets of rule from cache (remembers key for store on miss)
+bool
+CMake::
+restoreArtifacts(Rule *rule, const ExecCmds &execCmds)
+{
+  std::string key;
+
+  if (! artifactKey(rule, execCmds, key))
+    return false;
+
+  const RuleArray targets = (rule->isGrouped() ? rule->group() : RuleArray { rule });
+
+  auto entry = artifactEntry(key);
+
+  struct stat sb;
+
+  if (::stat(entry.c_str(), &sb) == 0 && S_ISDIR(sb.st_mode)) {
+    size_t n = 0;
+
+    for ( ; n < targets.size(); ++n) {
+      const auto &name = targets[n]->lhs();
+
+      auto file = entry + "/" + std::to_string(n);
+
+      ::unlink(name.c_str());
+
+      // restore writable copy (cache file is read-only) unless hard linked
+      bool linked = (artifactLink_ && ::link(file.c_str(), name.c_str()) == 0);
+
+      if (! linked) {
+        struct stat sb1;
+
+        if (::stat(file.c_str(), &sb1) != 0 ||
+            ! CMakeCloneFile(file, name, mode_t((sb1.st_mode & 0777) | S_IWUSR)))
+          break;
+      }
+
+      // restored target is new (hard link has cached file's time)
+      ::utimensat(AT_FDCWD, name.c_str(), nullptr, 0);
+    }
+
+    if (n == targets.size()) {
+      ::utimensat(AT_FDCWD, entry.c_str(), nullptr, 0);
+
+      ++artifactStats_.hits;
+
+      if (isDebug())
+        std::cerr << "ARTIFACT HIT : " << rule->lhs() << "\n";
+
+      return true;
+    }
+
+    // entry removed while restoring
+    for (size_t i = 0; i < n; ++i)
+      ::unlink(targets[i]->lhs().c_str());
+  }
+
+  ++artifactStats_.misses;
+
+  if (isDebug())
+    std::cerr << "ARTIFACT MISS : " << rule->lhs() << "\n";
+
+  // don't let commands write into a hard linked cache file
+  for (const auto *target : targets) {
+    if (::lstat(target->lhs().c_str(), &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_nlink > 1)
+      ::unlink(target->lhs().c_str());
+  }
+
+  artifactKeys_[rule] = key;
+
+  return false;
+}
+
+// store targets of rule built for cache miss
+void
+CMake::
+storeArtifacts(Rule *rule)
+{
+  auto p = artifactKeys_.find(rule);
+
+  if (p == artifactKeys_.end())
+    return;
+
+  auto key = (*p).second;
+
+  artifactKeys_.erase(p);
+
+  const RuleArray targets = (rule->isGrouped() ? rule->group() : RuleArray { rule });
+
+  auto tmpDir = artifactDir_ + "/tmp/" + key + "." + std::to_string(::getpid());
+
+  if (::mkdir(tmpDir.c_str(), 0755) != 0)
+    return;
+
+  int64_t size = 0;
+
+  bool rc = true;
+
+  for (size_t i = 0; rc && i < targets.size(); ++i) {
+    const auto &name = targets[i]->lhs();
+
+    struct stat sb;
+
+    // cache files are read-only
+    rc = (::stat(name.c_str(), &sb) == 0 && S_ISREG(sb.st_mode) &&
+          CMakeCloneFile(name, tmpDir + "/" + std::to_string(i),
+                         mode_t(sb.st_mode & 0555)));
+
+    size += int64_t(sb.st_size);
+  }
+
+  if (rc) {
+    auto entry = artifactEntry(key);
+
+    ::mkdir(entry.substr(0, entry.rfind('/')).c_str(), 0755);
+
+    rc = (::rename(tmpDir.c_str(), entry.c_str()) == 0);
+  }
+
+  if (! rc) {
+    CMakeRemoveDir(tmpDir);
+    return;
+  }
+
+  ++artifactStats_.stores;
+
+  artifactStats_.size += size;
+
+  if (isDebug())
+    std::cerr << "ARTIFACT STORE : " << rule->lhs() << "\n";
+}
+
+// remove least recently used entries until below maximum size (also
+// recalculates size)
+void
+CMake::
+evictArtifacts(ArtifactStats &stats)
+{
+  struct Entry {
+    std::string path;
+    FileTime    mtime { 0 };
+    int64_t     size  { 0 };
+  };
+
+  std::vector<Entry> entries;
+
+  int64_t total = 0;
+
+  std::vector<std::string> dirs;
+
+  CMakeListDir(artifactDir_, dirs);
+
+  for (const auto &dir : dirs) {
+    if (dir.size() != 2)
+      continue;
+
+    std::vector<std::string> keys;
+
+    CMakeListDir(artifactDir_ + "/" + dir, keys);
+
+    for (const auto &key : keys) {
+      Entry entry;
+
+      entry.path = artifactDir_ + "/" + dir + "/" + key;
+
+      struct stat sb;
+
+      if (::stat(entry.path.c_str(), &sb) != 0)
+        continue;
+
+      entry.mtime = CMakeStatTime(sb);
+
+      std::vector<std::string> files;
+
+      CMakeListDir(entry.path, files);
+
+      for (const auto &file : files) {
+        if (::stat((entry.path + "/" + file).c_str(), &sb) == 0)
+          entry.size += int64_t(sb.st_size);
+      }
+
+      total += entry.size;
+
+      entries.push_back(std::move(entry));
+    }
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const Entry &e1, const Entry &e2) {
+    return e1.mtime < e2.mtime;
+  });
+
+  // evict down to 3/4 of maximum so eviction is not needed every run
+  auto maxSize = int64_t(artifactMaxSize_ - artifactMaxSize_/4);
+
+  for (const auto &entry : entries) {
+    if (total <= maxSize)
+      break;
+
+    // move out of cache first so it is not restored while partly removed
+    auto tmpDir = artifactDir_ + "/tmp/evict." + std::string(CMakeBaseName(entry.path)) +
+                  "." + std::to_string(::getpid());
+
+    if (::rename(entry.path.c_str(), tmpDir.c_str()) != 0)
+      continue;
+
+    CMakeRemoveDir(tmpDir);
+
+    total -= entry.size;
+
+    ++stats.evictions;
+    ++artifactStats_.evictions;
+  }
+
+  stats.size = total;
+}
+
+// add run counts to cache stats (evicting if over size) and optionally print
+bool
+CMake::
+saveArtifactStats(bool print)
+{
+  if (! isArtifactCache())
+    return true;
+
+  int fd = ::open((artifactDir_ + "/lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+  if (fd >= 0)
+    ::flock(fd, LOCK_EX);
+
+  auto statsFile = artifactDir_ + "/stats";
+
+  ArtifactStats stats;
+
+  {
+  std::ifstream is(statsFile);
+
+  std::string name;
+  int64_t     value;
+
+  while (is >> name >> value) {
+    if      (name == "hits"     ) stats.hits      = uint64_t(value);
+    else if (name == "misses"   ) stats.misses    = uint64_t(value);
+    else if (name == "stores"   ) stats.stores    = uint64_t(value);
+    else if (name == "evictions") stats.evictions = uint64_t(value);
+    else if (name == "size"     ) stats.size      = value;
+  }
+  }
+
+  stats.hits   += artifactStats_.hits;
+  stats.misses += artifactStats_.misses;
+  stats.stores += artifactStats_.stores;
+  stats.size   += artifactStats_.size;
+
+  if (stats.size > int64_t(artifactMaxSize_))
+    evictArtifacts(stats);
+
+  bool rc = true;
+
+  auto tmpFile = statsFile + ".tmp";
+
+  {
+  std::ofstream os(tmpFile);
+
+  os << "hits "      << stats.hits      << "\n";
+  os << "misses "    << stats.misses    << "\n";
+  os << "stores "    << stats.stores    << "\n";
+  os << "evictions " << stats.evictions << "\n";
+  os << "size "      << stats.size      << "\n";
+
+  rc = bool(os);
+  }
+
+  if (! rc || ::rename(tmpFile.c_str(), statsFile.c_str()) != 0) {
+    std::cerr << "Failed to write '" << statsFile << "'\n";
+    rc = false;
+  }
+
+  if (fd >= 0)
+    ::close(fd);
+
+  if (print) {
+    auto mb = [](int64_t size) {
+      char buffer[32];
+
+      snprintf(buffer, sizeof(buffer), "%.1f", double(size)/(1024*1024));
+
+      return std::string(buffer);
+    };
+
+    std::cerr << "Artifact cache '" << artifactDir_ << "'\n";
+    std::cerr << "  run   : " << artifactStats_.hits << " hits, " <<
+                 artifactStats_.misses << " misses, " << artifactStats_.stores <<
+                 " stored, " << artifactStats_.evictions << " evicted\n";
+    std::cerr << "  total : " << stats.hits << " hits, " << stats.misses << " misses, " <<
+                 stats.stores << " stored, " << stats.evictions << " evicted, " <<
+                 mb(stats.size) << " of " << mb(int64_t(artifactMaxSize_)) << " MB\n";
+  }
+
+  return rc;
+}
+
+// forget cached file state (file rebuilt)
+void
+CMake::
+invalidateFileStat(SymbolId id)
+{
+  if (id < fileStats_.size())
+    fileStats_[id].valid = false;
+
+  // file may have been created so directory listing is stale
+  dirListings_.erase(std::string(CMakeDirName(symbols_.name(id))));
+}
+
+bool
+CMake::DirListing::
+contains(std::string_view name) const
+{
+  auto p = std::lower_bound(entries.begin(), entries.end(), name,
+    [](const DirEntry &entry, std::string_view name) { return entry.name < name; });
+
+  return (p != entries.end() && (*p).name == name);
+}
+
+// get cached directory listing
+const CMake::DirListing &
+CMake::
+dirListing(std::string_view dir) const
+{
+  while (dir.size() > 1 && dir.back() == '/')
+    dir.remove_suffix(1);
+
+  if (dir.empty())
+    dir = ".";
+
+  std::string dirName(dir);
+
+  auto p = dirListings_.find(dirName);
+
+  if (p != dirListings_.end())
+    return (*p).second;
+
+  auto &listing = dirListings_[dirName];
+
+  DIR *dp = ::opendir(dirName.c_str());
+
+  if (! dp)
+    return listing;
+
+  listing.exists = true;
+
+  struct dirent *ep;
+
+  while ((ep = ::readdir(dp)) != nullptr) {
+    std::string_view name(ep->d_name);
+
+    if (name == "." || name == "..")
+      continue;
+
+    DirEntry entry;
+
+    entry.name = name;
+
+#ifdef _DIRENT_HAVE_D_TYPE
+    if      (ep->d_type == DT_DIR)
+      entry.isDir = true;
+    else if (ep->d_type == DT_UNKNOWN || ep->d_type == DT_LNK)
+#endif
+    {
+      struct stat sb;
+
+      auto path = CMakeJoinPath(dirName, name);
+
+      entry.isDir = (::stat(path.c_str(), &sb) == 0 && S_ISDIR(sb.st_mode));
+    }
+
+    listing.entries.push_back(std::move(entry));
+  }
+
+  ::closedir(dp);
+
+  std::sort(listing.entries.begin(), listing.entries.end(),
+    [](const DirEntry &lhs, const DirEntry &rhs) { return lhs.name < rhs.name; });
+
+  return listing;
+}
+
+// add vpath directive
+//  vpath pattern dirs : search dirs for files matching pattern
+//  vpath pattern      : clear search dirs for pattern
+//  vpath              : clear all search dirs
+void
+CMake::
+addVPath(const std::string &pattern, const std::string &dirs)
+{
+  vpathFiles_.clear();
+
+  if (pattern.empty()) {
+    vpaths_.clear();
+    return;
+  }
+
+  VPath vpath;
+
+  vpath.pattern = pattern;
+
+  CMakeForEachWord(dirs, [&](std::string_view word) {
+    // dirs are separated by spaces or colons
+    size_t pos = 0;
+
+    while (pos <= word.size()) {
+      auto pos1 = word.find(':', pos);
+
+      if (pos1 == std::string_view::npos)
+        pos1 = word.size();
+
+      if (pos1 > pos)
+        vpath.dirs.emplace_back(word.substr(pos, pos1 - pos));
+
+      pos = pos1 + 1;
+    }
+  });
+
+  if (vpath.dirs.empty()) {
+    vpaths_.erase(std::remove_if(vpaths_.begin(), vpaths_.end(),
+      [&](const VPath &vpath1) { return vpath1.pattern == pattern; }), vpaths_.end());
+    return;
+  }
+
+  vpaths_.push_back(std::move(vpath));
+}
+
+// get file for prerequisite (found in vpath dirs if no rule and not in
+// current directory). Results are memoized and directories are searched
+// using the cached directory listings.
+CMake::SymbolId
+CMake::
+vpathFile(SymbolId id) const
+{
+  // VPATH variable dirs (read on first use after makefiles are read, VPATH and
+  // the variables it uses can still change while parsing)
+  bool parsing = (parseDepth_ > 0);
+
+  if (! vpathVarSet_ || parsing) {
+    vpathVarDirs_.clear();
+
+    auto dirs = replaceVariables("$(VPATH)");
+
+    CMakeForEachWord(dirs, [&](std::string_view word) {
+      size_t pos = 0;
+
+      while (pos <= word.size()) {
+        auto pos1 = word.find(':', pos);
+
+        if (pos1 == std::string_view::npos)
+          pos1 = word.size();
+
+        if (pos1 > pos)
+          vpathVarDirs_.emplace_back(word.substr(pos, pos1 - pos));
+
+        pos = pos1 + 1;
+      }
+    });
+
+    vpathVarSet_ = ! parsing;
+  }
+
+  if (vpaths_.empty() && vpathVarDirs_.empty())
+    return id;
+
+  auto p = vpathFiles_.find(id);
+
+  if (p != vpathFiles_.end())
+    return (*p).second;
+
+  SymbolId fileId = id;
+
+  const auto &name = symbols_.name(id);
+
+  if (rules_.find(id) == rules_.end() && ! fileStat(id).exists &&
+      ! name.empty() && name[0] != '/') {
+    auto searchDirs = [&](const VPathDirs &dirs) {
+      for (const auto &dir : dirs) {
+        auto path = CMakeJoinPath(dir, name);
+
+        if (dirListing(CMakeDirName(path)).contains(CMakeBaseName(path))) {
+          fileId = symbols_.intern(path);
+          return true;
+        }
+      }
+
+      return false;
+    };
+
+    bool found = false;
+
+    for (const auto &vpath : vpaths_) {
+      std::string_view stem;
+
+      if (CMakeMatchPattern(vpath.pattern, vpath.pattern.find('%'), name, stem) &&
+          searchDirs(vpath.dirs)) {
+        found = true;
+        break;
+      }
+    }
+
+    if (! found)
+      searchDirs(vpathVarDirs_);
+
+    if (isDebug() && fileId != id)
+      std::cerr << "VPATH : " << name << " -> " << symbols_.name(fileId) << "\n";
+  }
+
+  if (! parsing)
+    vpathFiles_[id] = fileId;
+
+  return fileId;
+}
+
+// expand glob pattern using cached directory listings. Results are sorted.
+void
+CMake::
+globFiles(std::string_view pattern, std::vector<std::string> &files) const
+{
+  auto isWild = [](std::string_view str) {
+    return (str.find_first_of("*?[") != std::string_view::npos);
+  };
+
+  std::vector<std::string> paths, nextPaths;
+
+  paths.push_back(pattern.size() && pattern[0] == '/' ? "/" : "");
+
+  WordViews parts;
+
+  size_t pos = 0;
+
+  while (pos < pattern.size()) {
+    auto pos1 = pattern.find('/', pos);
+
+    if (pos1 == std::string_view::npos)
+      pos1 = pattern.size();
+
+    if (pos1 > pos)
+      parts.push_back(pattern.substr(pos, pos1 - pos));
+
+    pos = pos1 + 1;
+  }
+
+  bool lastWild = false;
+
+  for (size_t i = 0; i < parts.size(); ++i) {
+    auto part = parts[i];
+    bool last = (i == parts.size() - 1);
+
+    nextPaths.clear();
+
+    lastWild = isWild(part);
+
+    if (! lastWild) {
+      for (const auto &path : paths)
+        nextPaths.push_back(CMakeJoinPath(path, part));
+    }
+    else {
+      std::string partStr(part);
+
+      for (const auto &path : paths) {
+        const auto &listing = dirListing(path);
+
+        for (const auto &entry : listing.entries) {
+          // hidden files must be matched explicitly
+          if (entry.name[0] == '.' && part[0] != '.')
+            continue;
+
+          if (! last && ! entry.isDir)
+            continue;
+
+          if (::fnmatch(partStr.c_str(), entry.name.c_str(), FNM_PERIOD) == 0)
+            nextPaths.push_back(CMakeJoinPath(path, entry.name));
+        }
+      }
+    }
+
+    paths.swap(nextPaths);
+  }
+
+  auto n = files.size();
+
+  for (auto &path : paths) {
+    // matches from listing exist, otherwise check (shared) stat cache
+    if (! lastWild && ! fileStat(symbols_.intern(path)).exists)
+      continue;
+
+    files.push_back(std::move(path));
+  }
+
+  std::sort(files.begin() + n, files.end());
+}
+
+// spawn program (searched for in PATH) with environment and stdout redirected
+// to outFd (if not -1)
+static int
+CMakeSpawn(std::vector<std::string> &args, char *const *envp, int outFd, pid_t &pid)
+{
+  std::vector<char *> argv;
+
+  for (auto &arg : args)
+    argv.push_back(&arg[0]);
+
+  argv.push_back(nullptr);
+
+  posix_spawn_file_actions_t actions;
+
+  ::posix_spawn_file_actions_init(&actions);
+
+  if (outFd >= 0)
+    ::posix_spawn_file_actions_adddup2(&actions, outFd, STDOUT_FILENO);
+
+  int rc = ::posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), envp);
+
+  ::posix_spawn_file_actions_destroy(&actions);
+
+  return rc;
+}
+
+// wait for process and return exit status
+static int
+CMakeWaitStatus(pid_t pid)
+{
+  int wstatus = 0;
+
+  while (::waitpid(pid, &wstatus, 0) < 0) {
+    if (errno != EINTR)
+      return -1;
+  }
+
+  return (WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : 128 + WTERMSIG(wstatus));
+}
+
+bool
+CMake::
+exec(const std::string &cmd, char *const *envp, bool silent)
+{
+  {
+  std::unique_lock<std::mutex> lock(outputMutex_);
+
+  if (isDebug())
+    std::cerr << "EXEC : " << cmd << "\n";
+
+  if (! silent)
+    std::cerr << cmd << "\n";
+  }
+
+  std::vector<std::string> args = { "/bin/sh", "-c", cmd };
+
+  pid_t pid = 0;
+
+  bool rc = (CMakeSpawn(args, envp, -1, pid) == 0 && CMakeWaitStatus(pid) == 0);
+
+  if (! rc) {
+    std::unique_lock<std::mutex> lock(outputMutex_);
+
+    std::cerr << "Command failed: " << cmd << "\n";
+  }
+
+  return rc;
+}
+
+// run command and return output with trailing newlines removed and other
+// newlines replaced by spaces
+std::string
+CMake::
+shellCommand(const std::string &cmd) const
+{
+  // pure commands are cached by command and environment
+  bool pure = isPureShellCommand(cmd);
+
+  std::string key;
+
+  if (pure) {
+    auto env = commandEnv();
+
+    key = cmd + '\0' + std::to_string(env ? env->envHash : 0);
+
+    // parse result depends on environment
+    if (parseDepth_ > 0)
+      parsePureShell_ = true;
+
+    auto p = shellResults_.find(key);
+
+    if (p != shellResults_.end()) {
+      if (isDebug())
+        std::cerr << "SHELL (cached) : " << cmd << "\n";
+
+      return (*p).second;
+    }
+  }
+
+  // output can change between runs so parsed state (or expanded commands)
+  // can't be cached
+  if (! pure)
+    ++volatileCalls_;
+
+  if (isDebug())
+    std::cerr << "SHELL : " << cmd << "\n";
+
+  std::string output;
+  int         status = 0;
+
+  if (! runCapture(cmd, output, status))
+    std::cerr << "Failed to run '" << cmd << "'\n";
+
+  while (! output.empty() && (output.back() == '\n' || output.back() == '\r'))
+    output.pop_back();
+
+  for (auto &c : output) {
+    if (c == '\n')
+      c = ' ';
+  }
+
+  if (pure)
+    shellResults_[key] = output;
+
+  return output;
+}
+
+// check if command program is listed in .SHELL_CACHE (no prerequisites
+// marks all commands as pure)
+bool
+CMake::
+isPureShellCommand(const std::string &cmd) const
+{
+  if (shellCacheAll_)
+    return true;
+
+  if (shellProgs_.empty())
+    return false;
+
+  std::string_view prog;
+
+  CMakeForEachWord(cmd, [&](std::string_view word) {
+    if (prog.empty())
+      prog = word;
+  });
+
+  return (shellProgs_.find(std::string(CMakeBaseName(prog))) != shellProgs_.end());
+}
+
+// run command with stdout captured through a pipe. Commands without shell
+// syntax are spawned directly, others use a single /bin/sh -c.
+bool
+CMake::
+runCapture(const std::string &cmd, std::string &output, int &status) const
+{
+  static const char *shellChars = "|&;<>()$`\\\"'*?[]#~=%{}\n";
+
+  std::vector<std::string> words;
+
+  if (cmd.find_first_of(shellChars) == std::string::npos) {
+    CMakeForEachWord(cmd, [&](std::string_view word) { words.emplace_back(word); });
+
+    if (words.empty())
+      return true;
+  }
+
+  int fds[2];
+
+#ifdef __APPLE__
+  if (::pipe(fds) != 0)
+    return false;
+
+  ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+  ::fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#else
+  if (::pipe2(fds, O_CLOEXEC) != 0)
+    return false;
+#endif
+
+  auto envp = commandEnvp(commandEnv());
+
+  pid_t pid = 0;
+
+  int rc = -1;
+
+  if (! words.empty())
+    rc = CMakeSpawn(words, envp, fds[1], pid);
+
+  // shell syntax or not an executable (e.g. shell builtin)
+  if (rc != 0) {
+    std::vector<std::string> shellArgs = { "/bin/sh", "-c", cmd };
+
+    rc = CMakeSpawn(shellArgs, envp, fds[1], pid);
+  }
+
+  ::close(fds[1]);
+
+  if (rc != 0) {
+    ::close(fds[0]);
+    return false;
+  }
+
+  char buffer[4096];
+
+  while (true) {
+    auto n = ::read(fds[0], buffer, sizeof(buffer));
+
+    if (n < 0 && errno == EINTR)
+      continue;
+
+    if (n <= 0)
+      break;
+
+    output.append(buffer, size_t(n));
+  }
+
+  ::close(fds[0]);
+
+  status = CMakeWaitStatus(pid);
+
+  return true;
+}
+
+std::string
+CMake::
+replaceVariables(const std::string &str) const
+{
+  // nothing to expand
+  if (str.find('$') == std::string::npos)
+    return str;
+
+  Expansion expansion;
+
+  compileExpansion(str, expansion);
+
+  std::string str1;
+
+  str1.reserve(str.size());
+
+  expandTo(expansion, str1);
+
+  return str1;
+}
+
+// compile string into list of literal text and variable references
+//  $$ is a literal '$'
+//  $(name), ${name} and $c are variable references
+void
+CMake::
+compileExpansion(std::string_view str, Expansion &expansion) const
+{
+  size_t len = str.size();
+
+  size_t i     = 0;
+  size_t start = 0;
+
+  while (i < len) {
+    if (str[i] != '$') {
+      ++i;
+      continue;
+    }
+
+    expansion.addText(str.substr(start, i - start));
+
+    // trailing '$'
+    if (i + 1 >= len) {
+      expansion.addText("$");
+
+      i = start = len;
+
+      break;
+    }
+
+    char c = str[i + 1];
+
+    if      (c == '$') {
+      expansion.addText("$");
+
+      i += 2;
+    }
+    else if (c == '(' || c == '{') {
+      char c1 = (c == '(' ? ')' : '}');
+
+      // find matching close bracket (only brackets of the same type nest)
+      size_t j     = i + 2;
+      int    depth = 1;
+
+      for ( ; j < len; ++j) {
+        if      (str[j] == c)
+          ++depth;
+        else if (str[j] == c1) {
+          if (--depth == 0)
+            break;
+        }
+      }
+
+      // unterminated reference is literal text
+      if (j >= len) {
+        expansion.addText(str.substr(i));
+
+        i = start = len;
+
+        break;
+      }
+
+      auto name = str.substr(i + 2, j - i - 2);
+
+      // function call ($(name args))
+      auto fpos = name.find_first_of(" \t");
+
+      const FunctionDef *func =
+        (fpos != std::string_view::npos ? lookupFunction(name.substr(0, fpos)) : nullptr);
+
+      // substitution reference ($(var:a=b) is $(patsubst %a,%b,$(var)))
+      auto cpos = (! func ? findRuleColon(name) : std::string_view::npos);
+      auto epos = (cpos != std::string_view::npos ? name.find('=', cpos) : cpos);
+
+      if      (func) {
+        compileFunction(func, name.substr(0, fpos), name.substr(fpos + 1), expansion);
+      }
+      else if (epos != std::string_view::npos) {
+        auto from = name.substr(cpos + 1, epos - cpos - 1);
+        auto to   = name.substr(epos + 1);
+
+        std::string argsStr;
+
+        if (from.find('%') == std::string_view::npos) {
+          argsStr += "%"; argsStr += from; argsStr += ",";
+          argsStr += "%"; argsStr += to  ; argsStr += ",";
+        }
+        else {
+          argsStr += from; argsStr += ",";
+          argsStr += to  ; argsStr += ",";
+        }
+
+        argsStr += "$("; argsStr += name.substr(0, cpos); argsStr += ")";
+
+        compileFunction(lookupFunction("patsubst"), "patsubst", argsStr, expansion);
+      }
+      else if (name.find('$') != std::string_view::npos) {
+        auto &part = expansion.addVariable(name, NO_SYMBOL);
+
+        part.nameExp = std::make_shared<Expansion>();
+
+        compileExpansion(name, *part.nameExp);
+      }
+      else if (isAutoVariable(name))
+        expansion.addAuto(name);
+      else
+        expansion.addVariable(name, symbols_.intern(name));
+
+      i = j + 1;
+    }
+    else {
+      auto name = str.substr(i + 1, 1);
+
+      if (isAutoVariable(name))
+        expansion.addAuto(name);
+      else
+        expansion.addVariable(name, symbols_.intern(name));
+
+      i += 2;
+    }
+
+    start = i;
+  }
+
+  expansion.addText(str.substr(start, len - start));
+}
+
+// append expanded value of compiled string
+void
+CMake::
+expandTo(const Expansion &expansion, std::string &str, const AutoVars *autoVars) const
+{
+  for (const auto &part : expansion.parts()) {
+    if      (part.type == Expansion::PartType::TEXT)
+      str += part.text;
+    else if (part.type == Expansion::PartType::AUTO) {
+      // automatic variables are empty outside of rule commands
+      if (autoVars)
+        autoVars->expand(part.text, str);
+    }
+    else if (part.type == Expansion::PartType::FUNCTION) {
+      (this->*part.func->proc)(part.args, str, autoVars);
+    }
+    else {
+      if (part.nameExp) {
+        std::string name;
+
+        expandTo(*part.nameExp, name, autoVars);
+
+        expandVariable(symbols_.intern(name), str, autoVars);
+      }
+      else
+        expandVariable(part.id, str, autoVars);
+    }
+  }
+}
+
+// append expanded value of variable (deferred variables are expanded
+// recursively using their cached compiled value)
+void
+CMake::
+expandVariable(SymbolId id, std::string &str, const AutoVars *autoVars) const
+{
+  auto *var = getVariable(id);
+
+  // undefined variable is empty
+  if (! var) {
+    if (isDebug())
+      std::cerr << "UNDEFINED VAR: " << symbols_.name(id) << "\n";
+
+    return;
+  }
+
+  if (! var->deferred) {
+    str += var->value;
+    return;
+  }
+
+  if (var->expanding) {
+    std::cerr << "Recursive variable '" << var->name << "' references itself\n";
+    return;
+  }
+
+  if (! var->expansion) {
+    var->expansion = std::make_shared<Expansion>();
+
+    compileExpansion(var->value, *var->expansion);
+  }
+
+  var->expanding = true;
+
+  expandTo(*var->expansion, str, autoVars);
+
+  var->expanding = false;
+}
+
+//---
+
+// append space separated words to string
+class CMakeWordWriter {
+ public:
+  CMakeWordWriter(std::string &str) :
+   str_(str) {
+  }
+
+  void add(std::string_view word) {
+    if (! first_)
+      str_ += ' ';
+
+    str_.append(word.data(), word.size());
+
+    first_ = false;
+  }
+
+  // add word in parts (no separator between parts)
+  void start() {
+    if (! first_)
+      str_ += ' ';
+
+    first_ = false;
+  }
+
+  void append(std::string_view str) { str_.append(str.data(), str.size()); }
+
+ private:
+  std::string &str_;
+  bool         first_ { true };
+};
+
+static std::string_view
+CMakeStripView(std::string_view str)
+{
+  while (! str.empty() && isspace(static_cast<unsigned char>(str.front())))
+    str.remove_prefix(1);
+
+  while (! str.empty() && isspace(static_cast<unsigned char>(str.back())))
+    str.remove_suffix(1);
+
+  return str;
+}
+
+const CMake::FunctionDef *
+CMake::
+lookupFunction(std::string_view name)
+{
+  using Functions = std::unordered_map<std::string_view,FunctionDef>;
+
+  static Functions functions = {{
+    { "subst"     , { &CMake::funcSubst     , 3, 3 } },
+    { "patsubst"  , { &CMake::funcPatSubst  , 3, 3 } },
+    { "strip"     , { &CMake::funcStrip     , 1, 1 } },
+    { "findstring", { &CMake::funcFindString, 2, 2 } },
+    { "filter"    , { &CMake::funcFilter    , 2, 2 } },
+    { "filter-out", { &CMake::funcFilterOut , 2, 2 } },
+    { "sort"      , { &CMake::funcSort      , 1, 1 } },
+    { "word"      , { &CMake::funcWord      , 2, 2 } },
+    { "wordlist"  , { &CMake::funcWordList  , 3, 3 } },
+    { "words"     , { &CMake::funcWords     , 1, 1 } },
+    { "firstword" , { &CMake::funcFirstWord , 1, 1 } },
+    { "lastword"  , { &CMake::funcLastWord  , 1, 1 } },
+    { "dir"       , { &CMake::funcDir       , 1, 1 } },
+    { "notdir"    , { &CMake::funcNotDir    , 1, 1 } },
+    { "basename"  , { &CMake::funcBaseName  , 1, 1 } },
+    { "addprefix" , { &CMake::funcAddPrefix , 2, 2 } },
+    { "addsuffix" , { &CMake::funcAddSuffix , 2, 2 } },
+    { "wildcard"  , { &CMake::funcWildcard  , 1, 1 } },
+    { "foreach"   , { &CMake::funcForEach   , 3, 3 } },
+    { "if"        , { &CMake::funcIf        , 2, 3 } },
+    { "call"      , { &CMake::funcCall      , 1, 1000 } },
+    { "shell"     , { &CMake::funcShell     , 1, 1 } },
+  }};
+
+  auto p = functions.find(name);
+
+  if (p == functions.end())
+    return nullptr;
+
+  return &(*p).second;
+}
+
+// compile function args (comma separated, last arg gets any extra commas)
+void
+CMake::
+compileFunction(const FunctionDef *func, std::string_view name, std::string_view argsStr,
+                Expansion &expansion) const
+{
+  Expansion::Args args;
+
+  auto addArg = [&](std::string_view arg) {
+    auto argExp = std::make_shared<Expansion>();
+
+    compileExpansion(arg, *argExp);
+
+    args.push_back(argExp);
+  };
+
+  // skip space before first arg
+  while (! argsStr.empty() && isspace(static_cast<unsigned char>(argsStr.front())))
+    argsStr.remove_prefix(1);
+
+  size_t start = 0;
+  int    depth = 0;
+
+  for (size_t i = 0; i < argsStr.size(); ++i) {
+    char c = argsStr[i];
+
+    if      (c == '(' || c == '{')
+      ++depth;
+    else if (c == ')' || c == '}')
+      --depth;
+    else if (c == ',' && depth == 0 && int(args.size()) < func->maxArgs - 1) {
+      addArg(argsStr.substr(start, i - start));
+
+      start = i + 1;
+    }
+  }
+
+  addArg(argsStr.substr(start));
+
+  if (int(args.size()) < func->minArgs)
+    std::cerr << "Insufficient number of arguments to function '" << name << "'\n";
+
+  while (int(args.size()) < func->minArgs)
+    args.push_back(std::make_shared<Expansion>());
+
+  auto &part = expansion.addFunction(name, func);
+
+  part.args = std::move(args);
+}
+
+std::string
+CMake::
+expandArg(const FunctionArgs &args, size_t i, const AutoVars *autoVars) const
+{
+  std::string str;
+
+  if (i < args.size())
+    expandTo(*args[i], str, autoVars);
+
+  return str;
+}
+
+// $(subst from,to,text)
+void
+CMake::
+funcSubst(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto from = expandArg(args, 0, autoVars);
+  auto to   = expandArg(args, 1, autoVars);
+  auto text = expandArg(args, 2, autoVars);
+
+  if (from.empty()) {
+    str += text;
+    return;
+  }
+
+  size_t pos = 0;
+
+  while (true) {
+    auto pos1 = text.find(from, pos);
+
+    if (pos1 == std::string::npos)
+      break;
+
+    str.append(text, pos, pos1 - pos);
+    str.append(to);
+
+    pos = pos1 + from.size();
+  }
+
+  str.append(text, pos, std::string::npos);
+}
+
+// $(patsubst pattern,replacement,text)
+void
+CMake::
+funcPatSubst(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto pattern     = expandArg(args, 0, autoVars);
+  auto replacement = expandArg(args, 1, autoVars);
+  auto text        = expandArg(args, 2, autoVars);
+
+  auto ppos = pattern    .find('%');
+  auto rpos = replacement.find('%');
+
+  std::string_view rview(replacement);
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    std::string_view stem;
+
+    if (! CMakeMatchPattern(pattern, ppos, word, stem)) {
+      writer.add(word);
+      return;
+    }
+
+    writer.start();
+
+    if (rpos == std::string::npos || ppos == std::string::npos)
+      writer.append(rview);
+    else {
+      writer.append(rview.substr(0, rpos));
+      writer.append(stem);
+      writer.append(rview.substr(rpos + 1));
+    }
+  });
+}
+
+// $(strip string)
+void
+CMake::
+funcStrip(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) { writer.add(word); });
+}
+
+// $(findstring find,in)
+void
+CMake::
+funcFindString(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto find = expandArg(args, 0, autoVars);
+  auto in   = expandArg(args, 1, autoVars);
+
+  if (in.find(find) != std::string::npos)
+    str += find;
+}
+
+// $(filter pattern...,text)
+void
+CMake::
+funcFilter(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  filterWords(args, str, autoVars, /*keep*/true);
+}
+
+// $(filter-out pattern...,text)
+void
+CMake::
+funcFilterOut(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  filterWords(args, str, autoVars, /*keep*/false);
+}
+
+// keep (or remove) words matching patterns (exact patterns use a hash set so
+// filtering is linear in the number of words)
+void
+CMake::
+filterWords(const FunctionArgs &args, std::string &str,
+            const AutoVars *autoVars, bool keep) const
+{
+  auto patterns = expandArg(args, 0, autoVars);
+  auto text     = expandArg(args, 1, autoVars);
+
+  std::unordered_set<std::string_view>       exact;
+  std::vector<std::pair<std::string_view,size_t>> wild;
+
+  CMakeForEachWord(patterns, [&](std::string_view pattern) {
+    auto pos = pattern.find('%');
+
+    if (pos == std::string_view::npos)
+      exact.insert(pattern);
+    else
+      wild.emplace_back(pattern, pos);
+  });
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    bool match = (exact.find(word) != exact.end());
+
+    for (size_t i = 0; ! match && i < wild.size(); ++i) {
+      std::string_view stem;
+
+      match = CMakeMatchPattern(wild[i].first, wild[i].second, word, stem);
+    }
+
+    if (match == keep)
+      writer.add(word);
+  });
+}
+
+// $(sort list)
+void
+CMake::
+funcSort(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  WordViews words;
+
+  splitWords(text, words);
+
+  std::sort(words.begin(), words.end());
+
+  auto pe = std::unique(words.begin(), words.end());
+
+  CMakeWordWriter writer(str);
+
+  for (auto p = words.begin(); p != pe; ++p)
+    writer.add(*p);
+}
+
+// $(word n,text)
+void
+CMake::
+funcWord(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto nstr = expandArg(args, 0, autoVars);
+  auto text = expandArg(args, 1, autoVars);
+
+  long n = atol(nstr.c_str());
+
+  if (n <= 0) {
+    std::cerr << "First argument to 'word' function must be greater than 0\n";
+    return;
+  }
+
+  long i = 0;
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    if (++i == n)
+      str.append(word.data(), word.size());
+  });
+}
+
+// $(wordlist start,end,text)
+void
+CMake::
+funcWordList(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto sstr = expandArg(args, 0, autoVars);
+  auto estr = expandArg(args, 1, autoVars);
+  auto text = expandArg(args, 2, autoVars);
+
+  long s = atol(sstr.c_str());
+  long e = atol(estr.c_str());
+
+  if (s <= 0) {
+    std::cerr << "First argument to 'wordlist' function must be greater than 0\n";
+    return;
+  }
+
+  CMakeWordWriter writer(str);
+
+  long i = 0;
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    ++i;
+
+    if (i >= s && i <= e)
+      writer.add(word);
+  });
+}
+
+// $(words text)
+void
+CMake::
+funcWords(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  long n = 0;
+
+  CMakeForEachWord(text, [&](std::string_view) { ++n; });
+
+  str += std::to_string(n);
+}
+
+// $(firstword names...)
+void
+CMake::
+funcFirstWord(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  bool found = false;
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    if (! found)
+      str.append(word.data(), word.size());
+
+    found = true;
+  });
+}
+
+// $(lastword names...)
+void
+CMake::
+funcLastWord(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  std::string_view last;
+
+  CMakeForEachWord(text, [&](std::string_view word) { last = word; });
+
+  str.append(last.data(), last.size());
+}
+
+// $(dir names...)
+void
+CMake::
+funcDir(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    auto pos = word.rfind('/');
+
+    if (pos != std::string_view::npos)
+      writer.add(word.substr(0, pos + 1));
+    else
+      writer.add("./");
+  });
+}
+
+// $(notdir names...)
+void
+CMake::
+funcNotDir(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    auto pos = word.rfind('/');
+
+    writer.add(pos != std::string_view::npos ? word.substr(pos + 1) : word);
+  });
+}
+
+// $(basename names...)
+void
+CMake::
+funcBaseName(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    auto pos  = word.rfind('.');
+    auto spos = word.rfind('/');
+
+    if (pos != std::string_view::npos && (spos == std::string_view::npos || pos > spos))
+      writer.add(word.substr(0, pos));
+    else
+      writer.add(word);
+  });
+}
+
+// $(addprefix prefix,names...)
+void
+CMake::
+funcAddPrefix(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto prefix = expandArg(args, 0, autoVars);
+  auto text   = expandArg(args, 1, autoVars);
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    writer.start();
+    writer.append(prefix);
+    writer.append(word);
+  });
+}
+
+// $(addsuffix suffix,names...)
+void
+CMake::
+funcAddSuffix(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto suffix = expandArg(args, 0, autoVars);
+  auto text   = expandArg(args, 1, autoVars);
+
+  CMakeWordWriter writer(str);
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    writer.start();
+    writer.append(word);
+    writer.append(suffix);
+  });
+}
+
+// $(wildcard pattern...)
+void
+CMake::
+funcWildcard(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto text = expandArg(args, 0, autoVars);
+
+  // matched files can change between runs so parsed state (or expanded
+  // commands) can't be cached
+  ++volatileCalls_;
+
+  CMakeWordWriter writer(str);
+
+  std::vector<std::string> files;
+
+  CMakeForEachWord(text, [&](std::string_view word) {
+    files.clear();
+
+    globFiles(word, files);
+
+    for (const auto &file : files)
+      writer.add(file);
+  });
+}
+
+// $(foreach var,list,text)
+void
+CMake::
+funcForEach(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto name = expandArg(args, 0, autoVars);
+  auto list = expandArg(args, 1, autoVars);
+
+  auto saved = pushVariable(symbols_.intern(CMakeStripView(name)));
+
+  bool first = true;
+
+  CMakeForEachWord(list, [&](std::string_view word) {
+    if (! first)
+      str += ' ';
+
+    setTempVariable(saved, std::string(word));
+
+    expandTo(*args[2], str, autoVars);
+
+    first = false;
+  });
+
+  popVariable(saved);
+}
+
+// $(if condition,then-part[,else-part])
+void
+CMake::
+funcIf(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto cond = expandArg(args, 0, autoVars);
+
+  if (! CMakeStripView(cond).empty())
+    expandTo(*args[1], str, autoVars);
+  else if (args.size() > 2)
+    expandTo(*args[2], str, autoVars);
+}
+
+// $(call variable,param,param,...)
+void
+CMake::
+funcCall(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto name = std::string(CMakeStripView(expandArg(args, 0, autoVars)));
+
+  // $(0) is variable name, $(1)... are params
+  std::vector<SavedVariable> savedVars;
+
+  for (size_t i = 0; i < args.size(); ++i) {
+    auto value = (i > 0 ? expandArg(args, i, autoVars) : name);
+
+    savedVars.push_back(pushVariable(symbols_.intern(std::to_string(i))));
+
+    setTempVariable(savedVars.back(), value);
+  }
+
+  // expand body in new frame (not marked as expanding so function can call
+  // itself recursively)
+  auto *var = getVariable(symbols_.intern(name));
+
+  if      (! var) {
+  }
+  else if (! var->deferred)
+    str += var->value;
+  else {
+    if (! var->expansion) {
+      var->expansion = std::make_shared<Expansion>();
+
+      compileExpansion(var->value, *var->expansion);
+    }
+
+    // keep expansion if variable is changed while expanding
+    auto expansion = var->expansion;
+
+    expandTo(*expansion, str, autoVars);
+  }
+
+  for (auto p = savedVars.rbegin(); p != savedVars.rend(); ++p)
+    popVariable(*p);
+}
+
+// $(shell command)
+void
+CMake::
+funcShell(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const
+{
+  auto cmd = expandArg(args, 0, autoVars);
+
+  str += shellCommand(cmd);
+}
+
+// save variable state (to allow temporary value)
+CMake::SavedVariable
+CMake::
+pushVariable(SymbolId id) const
+{
+  SavedVariable saved;
+
+  saved.id = id;
+
+  auto p = variables_.find(id);
+
+  if (p != variables_.end()) {
+    saved.var     = (*p).second;
+    saved.defined = true;
+    saved.value   = *saved.var;
+  }
+  else {
+    auto *th = const_cast<CMake *>(this);
+
+    // reuse variable from previous push of undefined name
+    auto pt = tempVariables_.find(id);
+
+    if (pt != tempVariables_.end()) {
+      saved.var = (*pt).second;
+
+      th->variables_[id] = saved.var;
+    }
+    else {
+      saved.var = th->defineVariable(symbols_.name(id), "", false);
+
+      tempVariables_[id] = saved.var;
+    }
+  }
+
+  return saved;
+}
+
+void
+CMake::
+setTempVariable(const SavedVariable &saved, const std::string &value) const
+{
+  saved.var->value    = value;
+  saved.var->deferred = false;
+
+  saved.var->expansion.reset();
+}
+
+// restore saved variable state
+void
+CMake::
+popVariable(const SavedVariable &saved) const
+{
+  if (saved.defined)
+    *saved.var = saved.value;
+  else {
+    auto *th = const_cast<CMake *>(this);
+
+    th->variables_.erase(saved.id);
+  }
+}
+
+// check for automatic variable name ($@, $(@D), ...)
+bool
+CMake::
+isAutoVariable(std::string_view name)
+{
+  if (name.empty() || name.size() > 2)
+    return false;
+
+  if (! strchr("@<^+?*|", name[0]))
+    return false;
+
+  return (name.size() == 1 || name[1] == 'D' || name[1] == 'F');
+}
+
+void
+CMake::AutoVars::
+expand(std::string_view name, std::string &str) const
+{
+  char c   = name[0];
+  char mod = (name.size() > 1 ? name[1] : '\0');
+
+  switch (c) {
+    // target
+    case '@':
+      addWord(rule_->lhs(), mod, str);
+      break;
+    // first prerequisite
+    case '<':
+      if (! rule_->rids().empty())
+        addWord(make_->symbols_.name(make_->vpathFile(rule_->rids().front())), mod, str);
+      break;
+    // all prerequisites (duplicates removed)
+    case '^':
+      addWords(uniqueIds(), mod, str);
+      break;
+    // all prerequisites
+    case '+':
+      addWords(rule_->rids(), mod, str);
+      break;
+    // prerequisites newer than target
+    case '?':
+      addWords(newerIds(), mod, str);
+      break;
+    // stem
+    case '*':
+      addWord(rule_->stem(), mod, str);
+      break;
+    // order only prerequisites
+    case '|':
+      addWords(rule_->oids(), mod, str);
+      break;
+    default:
+      break;
+  }
+}
+
+void
+CMake::AutoVars::
+addWords(const SymbolIds &ids, char mod, std::string &str) const
+{
+  bool first = true;
+
+  for (const auto &id : ids) {
+    if (! first)
+      str += ' ';
+
+    addWord(make_->symbols_.name(make_->vpathFile(id)), mod, str);
+
+    first = false;
+  }
+}
+
+// add word (D is directory part, F is file part)
+void
+CMake::AutoVars::
+addWord(std::string_view word, char mod, std::string &str) const
+{
+  if (mod == '\0') {
+    str.append(word.data(), word.size());
+    return;
+  }
+
+  auto pos = word.rfind('/');
+
+  if (mod == 'D') {
+    if      (pos == std::string_view::npos)
+      str += '.';
+    else if (pos == 0)
+      str += '/';
+    else
+      str.append(word.data(), pos);
+  }
+  else {
+    auto file = (pos != std::string_view::npos ? word.substr(pos + 1) : word);
+
+    str.append(file.data(), file.size());
+  }
+}
+
+const CMake::SymbolIds &
+CMake::AutoVars::
+uniqueIds() const
+{
+  if (! uniqueSet_) {
+    std::unordered_set<SymbolId> ids;
+
+    for (const auto &id : rule_->rids()) {
+      if (ids.insert(id).second)
+        uniqueIds_.push_back(id);
+    }
+
+    uniqueSet_ = true;
+  }
+
+  return uniqueIds_;
+}
+
+const CMake::SymbolIds &
+CMake::AutoVars::
+newerIds() const
+{
+  if (! newerSet_) {
+    auto lstat = make_->fileStat(rule_->lhsId());
+
+    for (const auto &id : uniqueIds()) {
+      if (! lstat.exists || make_->fileStat(make_->vpathFile(id)).mtime > lstat.mtime)
+        newerIds_.push_back(id);
+    }
+
+    newerSet_ = true;
+  }
+
+  return newerIds_;
+}
+
+CMake::Variable *
+CMake::
+defineVariable(const std::string &name, const std::string &value, bool deferred)
+{
+  if (isDebug())
+    std::cerr << "DEFINE VAR: " << name << "=" << value << "\n";
+
+  auto id = symbols_.intern(name);
+
+  auto p = variables_.find(id);
+
+  if (p == variables_.end()) {
+    Variable *var = arena_.create<Variable>(name, value, deferred);
+
+    p = variables_.insert(p, Variables::value_type(id, var));
+  }
+
+  Variable *var = (*p).second;
+
+  var->value    = value;
+  var->deferred = deferred;
+  var->env      = false;
+
+  var->expansion.reset();
+
+  // command environment may need rebuilding (any change may affect a
+  // deferred exported variable)
+  if (! envDirty_ && (deferredExports_ || isExported(id, var)))
+    envDirty_ = true;
+
+  return var;
+}
+
+// append to variable value (with space separator). Text is added unexpanded
+// for deferred variables and expanded for immediate variables. The compiled
+// value of a deferred variable is extended with the new text only so a long
+// list built from many += lines is never recompiled or copied.
+//
+// Values are one string plus the incrementally compiled expansion rather than
+// a list of segments with their own flavor: each piece has the variable's
+// flavor, so a reference to a deferred variable still expands its whole
+// value, and the whole value is recompiled if the compiled expansion was in
+// use (or shared) when text was appended.
+void
+CMake::
+appendVariable(Variable *var, const std::string &value)
+{
+  if (isDebug())
+    std::cerr << "APPEND VAR: " << var->name << "+=" << value << "\n";
+
+  auto text = (var->deferred ? value : replaceVariables(value));
+
+  if (text.empty())
+    return;
+
+  bool sep = ! var->value.empty();
+
+  if (sep)
+    var->value += ' ';
+
+  var->value += text;
+
+  // compiled value may be shared (saved by foreach/call) or in use
+  if (var->expansion) {
+    if (var->expanding || var->expansion.use_count() > 1)
+      var->expansion.reset();
+    else {
+      if (sep)
+        var->expansion->addText(" ");
+
+      compileExpansion(text, *var->expansion);
+    }
+  }
+
+  var->env = false;
+
+  if (! envDirty_ && (deferredExports_ || isExported(symbols_.intern(var->name), var)))
+    envDirty_ = true;
+}
+
+// assign variable (command line variables can only be changed by override)
+CMake::Variable *
+CMake::
+assignVariable(const std::string &name, const std::string &op,
+               const std::string &value, bool override)
+{
+  auto id = symbols_.lookup(name);
+
+  if (id != NO_SYMBOL) {
+    auto p = variables_.find(id);
+
+    if (p != variables_.end() && (*p).second->cmdLine && ! override)
+      return (*p).second;
+  }
+
+  // set deferred name value
+  if      (op == "=")
+    return defineVariable(name, value, /*deferred*/true);
+  // set deferred name value (if not already defined)
+  else if (op == "?=") {
+    auto *var = getVariable(name);
+
+    if (var)
+      return var;
+
+    return defineVariable(name, value, /*deferred*/true);
+  }
+  // set name value
+  else if (op == ":=" || op == "::=")
+    return defineVariable(name, replaceVariables(value), /*deferred*/false);
+  // append to name value (deferred if not already defined)
+  else if (op == "+=") {
+    auto *var = getVariable(name);
+
+    if (! var)
+      return defineVariable(name, value, /*deferred*/true);
+
+    appendVariable(var, value);
+
+    return var;
+  }
+  // set name to shell command output
+  else if (op == "!=")
+    return defineVariable(name, shellCommand(replaceVariables(value)), /*deferred*/true);
+
+  return nullptr;
+}
+
+void
+CMake::
+undefineVariable(const std::string &name, bool override)
+{
+  auto id = symbols_.lookup(name);
+
+  if (id == NO_SYMBOL)
+    return;
+
+  auto p = variables_.find(id);
+
+  if (p == variables_.end() || ((*p).second->cmdLine && ! override))
+    return;
+
+  variables_.erase(p);
+
+  envDirty_ = true;
+}
+
+void
+CMake::
+setCommandLineVariable(const std::string &name, const std::string &value)
+{
+  auto *var = defineVariable(name, value, /*deferred*/true);
+
+  var->cmdLine = true;
+}
+
+// process override, export, unexport and private (may be combined and
+// followed by a define)
+void
+CMake::
+processModifiers(std::string_view keyword, std::string_view rest, Define &define)
+{
+  bool override = false, exported = false, unexported = false;
+
+  while (true) {
+    if      (keyword == "override")
+      override = true;
+    else if (keyword == "export")
+      exported = true;
+    else if (keyword == "unexport")
+      unexported = true;
+
+    // private only affects target specific variable inheritance (which is not
+    // supported) so it is ignored
+
+    size_t i = 0;
+
+    while (i < rest.size() && isspace(static_cast<unsigned char>(rest[i])))
+      ++i;
+
+    rest = rest.substr(i);
+
+    i = 0;
+
+    auto keyword1 = CMakeReadKeyword(rest, i);
+
+    if (keyword1 == "define") {
+      startDefine(rest.substr(i), define, override, exported);
+      return;
+    }
+
+    if (keyword1 != "override" && keyword1 != "export" &&
+        keyword1 != "unexport" && keyword1 != "private")
+      break;
+
+    keyword = keyword1;
+    rest    = rest.substr(i);
+  }
+
+  std::string name, op, value;
+
+  if (! unexported && CMakeParseAssign(rest, name, op, value)) {
+    if (name.find('$') != std::string::npos)
+      name = replaceVariables(name);
+
+    assignVariable(name, op, value, override);
+
+    if (exported)
+      setExported(name, true);
+  }
+  else if (exported || unexported)
+    setExported(replaceVariables(std::string(rest)), exported);
+  else
+    std::cerr << "BAD LINE: " << keyword << " " << rest << "\n";
+}
+
+// start define (define name [op])
+void
+CMake::
+startDefine(std::string_view rest, Define &define, bool override, bool exported)
+{
+  define = Define();
+
+  define.depth    = 1;
+  define.active   = true;
+  define.override = override;
+  define.exported = exported;
+
+  // remove comment
+  rest = rest.substr(0, rest.find('#'));
+
+  while (! rest.empty() && isspace(static_cast<unsigned char>(rest.back())))
+    rest.remove_suffix(1);
+
+  // op is last word (default is =)
+  auto pos = rest.find_last_of(" \t");
+
+  auto lastWord = (pos != std::string_view::npos ? rest.substr(pos + 1) : rest);
+
+  if      (lastWord.size() > 0 && CMakeAssignOp(lastWord) == lastWord) {
+    define.op = lastWord;
+
+    rest = rest.substr(0, rest.size() - lastWord.size());
+  }
+  else if (lastWord.size() > 1 && CMakeAssignOp(lastWord.substr(lastWord.size() - 1)) == "=") {
+    // op attached to name (e.g. define name:=)
+    auto opPos = lastWord.find_first_of("=:?+!");
+
+    define.op = lastWord.substr(opPos);
+
+    if (CMakeAssignOp(define.op) != define.op)
+      define.op = "=";
+    else
+      rest = rest.substr(0, rest.size() - (lastWord.size() - opPos));
+  }
+  else
+    define.op = "=";
+
+  define.name = replaceVariables(std::string(CMakeStripView(rest)));
+
+  if (define.name.empty()) {
+    std::cerr << "Empty variable name in define\n";
+
+    define.active = false;
+  }
+}
+
+// add line to define body (nested define/endef are part of body)
+void
+CMake::
+processDefineLine(std::string_view line, Define &define)
+{
+  size_t i = 0;
+
+  while (i < line.size() && (line[i] == ' ' || line[i] == '\t'))
+    ++i;
+
+  auto keyword = CMakeReadKeyword(line, i);
+
+  if      (keyword == "endef") {
+    if (--define.depth == 0) {
+      if (define.active) {
+        assignVariable(define.name, define.op, define.value, define.override);
+
+        if (define.exported)
+          setExported(define.name, true);
+      }
+
+      return;
+    }
+  }
+  else if (isDefineLine(line))
+    ++define.depth;
+
+  if (! define.active)
+    return;
+
+  if (define.lines++ > 0)
+    define.value += '\n';
+
+  define.value.append(line.data(), line.size());
+}
+
+// check for define line (possibly after override/export/private)
+bool
+CMake::
+isDefineLine(std::string_view line)
+{
+  size_t i = 0;
+
+  while (i < line.size() && isspace(static_cast<unsigned char>(line[i])))
+    ++i;
+
+  while (true) {
+    auto keyword = CMakeReadKeyword(line, i);
+
+    if (keyword == "define")
+      return true;
+
+    if (keyword != "override" && keyword != "export" && keyword != "private")
+      return false;
+  }
+}
+
+// set variables exported (or unexported). No names sets/clears export of
+// all variables.
 void
 CMake::
-make(Rule *rule)
+setExported(const std::string &names, bool exported)
+{
+  bool found = false;
+
+  CMakeForEachWord(names, [&](std::string_view name) {
+    exports_[symbols_.intern(name)] = exported;
+
+    found = true;
+  });
+
+  if (! found)
+    exportAll_ = exported;
+
+  envDirty_ = true;
+}
+
+// check if variable passed to command environment
+bool
+CMake::
+isExported(SymbolId id, const Variable *var) const
+{
+  auto p = exports_.find(id);
+
+  if (p != exports_.end())
+    return (*p).second;
+
+  if (exportAll_ || var->env || var->cmdLine)
+    return true;
+
+  // replaces environment variable
+  return (getenv(var->name.c_str()) != nullptr);
+}
+
+// get environment for commands (process environment with exported variables
+// replaced or added and unexported variables removed)
+CMake::CommandEnvP
+CMake::
+commandEnv() const
+{
+  if (commandEnv_ && ! envDirty_)
+    return commandEnv_;
+
+  // exported variable expansion runs $(shell) (use previous environment)
+  if (envBuilding_)
+    return commandEnv_;
+
+  envBuilding_ = true;
+
+  auto env = std::make_shared<CommandEnv>();
+
+  // inherited variables which are part of the artifact key (others, like
+  // HOME or USER, differ between users but not command results)
+  auto isKeyEnvName = [](std::string_view name) {
+    return (name == "PATH" || name == "LD_LIBRARY_PATH" || name == "DYLD_LIBRARY_PATH" ||
+            name == "LANG" || name == "LC_ALL");
+  };
+
+  std::vector<bool> keyStrs;
+
+  auto addVar = [&](SymbolId id, const Variable *var) {
+    std::string str = var->name + "=";
+
+    if (var->deferred) {
+      expandVariable(id, str);
+
+      deferredExports_ = true;
+    }
+    else
+      str += var->value;
+
+    env->strs.push_back(std::move(str));
+
+    keyStrs.push_back(! var->env || isKeyEnvName(var->name));
+  };
+
+  std::unordered_set<SymbolId> added;
+
+  for (char **e = environ; e && *e; ++e) {
+    std::string_view str(*e);
+
+    auto id = symbols_.lookup(str.substr(0, str.find('=')));
+
+    auto pe = exports_.find(id);
+
+    if (pe != exports_.end() && ! (*pe).second)
+      continue;
+
+    auto pv = (id != NO_SYMBOL ? variables_.find(id) : variables_.end());
+
+    if (pv != variables_.end()) {
+      addVar(id, (*pv).second);
+
+      added.insert(id);
+    }
+    else {
+      env->strs.emplace_back(str);
+
+      keyStrs.push_back(isKeyEnvName(str.substr(0, str.find('='))));
+    }
+  }
+
+  auto isValidName = [](const std::string &name) {
+    if (name.empty() || isdigit(static_cast<unsigned char>(name[0])))
+      return false;
+
+    for (auto c : name) {
+      if (! isalnum(static_cast<unsigned char>(c)) && c != '_')
+        return false;
+    }
+
+    return true;
+  };
+
+  for (const auto &pv : variables_) {
+    if (added.find(pv.first) != added.end())
+      continue;
+
+    if (isExported(pv.first, pv.second) && isValidName(pv.second->name))
+      addVar(pv.first, pv.second);
+  }
+
+  // hashes of whole environment and of artifact key part (order independent)
+  std::vector<std::string_view> strs, keys;
+
+  for (size_t i = 0; i < env->strs.size(); ++i) {
+    auto &str = env->strs[i];
+
+    env->envp.push_back(&str[0]);
+
+    strs.push_back(str);
+
+    if (keyStrs[i])
+      keys.push_back(str);
+  }
+
+  env->envHash = hashStrings(std::move(strs));
+  env->keyHash = hashStrings(std::move(keys));
+
+  env->envp.push_back(nullptr);
+
+  commandEnv_  = env;
+  envDirty_    = false;
+  envBuilding_ = false;
+
+  return commandEnv_;
+}
+
+char *const *
+CMake::
+commandEnvp(const CommandEnvP &env) const
+{
+  return (env ? env->envp.data() : environ);
+}
+
+bool
+CMake::
+isVariable(const std::string &name) const
+{
+  return (getVariable(name) != nullptr);
+}
+
+// get environment variable (lookups are recorded for parse cache)
+const char *
+CMake::
+lookupEnv(const std::string &name) const
+{
+  auto ptr = getenv(name.c_str());
+
+  auto &lookup = envLookups_[name];
+
+  lookup.exists = (ptr != nullptr);
+  lookup.value  = (ptr ? ptr : "");
+
+  return ptr;
+}
+
+CMake::Variable *
+CMake::
+getVariable(const std::string &name) const
+{
+  auto id = symbols_.lookup(name);
+
+  if (id != NO_SYMBOL) {
+    auto p = variables_.find(id);
+
+    if (p != variables_.end())
+      return (*p).second;
+  }
+
+  auto ptr = lookupEnv(name);
+
+  if (ptr) {
+    CMake *th = const_cast<CMake *>(this);
+
+    auto *var = th->defineVariable(name, ptr, false);
+
+    var->env = true;
+
+    return var;
+  }
+
+  return nullptr;
+}
+
+CMake::Variable *
+CMake::
+getVariable(SymbolId id) const
+{
+  auto p = variables_.find(id);
+
+  if (p != variables_.end())
+    return (*p).second;
+
+  const auto &name = symbols_.name(id);
+
+  auto ptr = lookupEnv(name);
+
+  if (ptr) {
+    CMake *th = const_cast<CMake *>(this);
+
+    auto *var = th->defineVariable(name, ptr, false);
+
+    var->env = true;
+
+    return var;
+  }
+
+  return nullptr;
+}
+
+CMake::Rule *
+CMake::
+defineRule(const std::string &lhs, const SymbolIds &rids)
+{
+  // .PHONY
+  // .SUFFIXES
+  // .DEFAULT
+  // .PRECIOUS
+  // .INTERMEDIATE
+  // .SECONDARY
+  // .SECONDEXPANSION
+  // .DELETE_ON_ERROR
+  // .IGNORE
+  // .LOW_RESOLUTION_TIME
+  // .SILENT
+  // .EXPORT_ALL_VARIABLES
+  // .NOTPARALLEL
+  // .ONESHELL
+  // .POSIX
+
+  if (lhs == ".PHONY") {
+    for (const auto &rid : rids) {
+      Rule *rule = getRule(rid);
+
+      if (rule)
+        rule->setPhony(true);
+    }
+
+    return nullptr;
+  }
+
+  // programs whose $(shell) output can be cached (all if no prerequisites)
+  if (lhs == ".SHELL_CACHE") {
+    if (rids.empty())
+      shellCacheAll_ = true;
+
+    for (const auto &rid : rids)
+      shellProgs_.insert(symbols_.name(rid));
+
+    return nullptr;
+  }
+
+  // scan #includes of prerequisites with suffixes (C/C++ sources if none)
+  if (lhs == ".SCAN_INCLUDES") {
+    scanIncludes_ = true;
+
+    if (rids.empty())
+      scanSuffixes_ = {{ ".c", ".cc", ".cpp", ".cxx", ".c++", ".C", ".m", ".mm",
+                         ".h", ".hh", ".hpp", ".hxx" }};
+
+    for (const auto &rid : rids)
+      scanSuffixes_.insert(symbols_.name(rid));
+
+    return nullptr;
+  }
+
+  if (lhs == ".LOW_RESOLUTION_TIME") {
+    for (const auto &rid : rids)
+      lowResTimeFiles_.insert(rid);
+
+    return nullptr;
+  }
+
+  // no prerequisites clears suffix list
+  if (lhs == ".SUFFIXES") {
+    if (rids.empty())
+      suffixes_.clear();
+
+    for (const auto &rid : rids)
+      suffixes_.push_back(symbols_.name(rid));
+
+    return nullptr;
+  }
+
+  implicitRules_.clear();
+
+  if (lhs.find('%') != std::string::npos)
+    return definePatternRule(lhs, rids);
+
+  // suffix rule (.c.o or .c) is pattern rule (%.o: %.c or %: %.c)
+  std::string targetSuffix, prereqSuffix;
+
+  if (rids.empty() && isSuffixRule(lhs, targetSuffix, prereqSuffix)) {
+    SymbolIds prids;
+
+    prids.push_back(symbols_.intern("%" + prereqSuffix));
+
+    return definePatternRule("%" + targetSuffix, prids);
+  }
+
+  auto id = symbols_.intern(lhs);
+
+  // another rule line for target adds its prerequisites to existing rule
+  auto p = rules_.find(id);
+
+  if (p != rules_.end()) {
+    auto *rule = (*p).second;
+
+    if (rule->isDoubleColon()) {
+      std::cerr << "Target '" << lhs << "' has both : and :: entries\n";
+      return nullptr;
+    }
+
+    rule->addRids(rids);
+
+    if (isDebug()) {
+      std::cerr << "MERGE RULE: "; rule->print();
+    }
+
+    return rule;
+  }
+
+  // rules are owned by the arena
+  auto *rule = arena_.create<Rule>(&symbols_, id, rids);
+
+  if (isDebug()) {
+    std::cerr << "DEFINE RULE: "; rule->print();
+  }
+
+  rules_[id] = rule;
+
+  if (lhs[0] != '.') {
+    if (! defRule_)
+      defRule_ = rule;
+  }
+
+  return rule;
+}
+
+// define rule for double colon rule line. Each line is a separate rule with its
+// own prerequisites and commands which is added to the end of the target's
+// chain. Pattern and special targets are ordinary rules.
+CMake::Rule *
+CMake::
+defineDoubleColonRule(const std::string &lhs, const SymbolIds &rids)
+{
+  if (lhs.empty() || lhs[0] == '.' || lhs.find('%') != std::string::npos)
+    return defineRule(lhs, rids);
+
+  auto id = symbols_.intern(lhs);
+
+  auto p = rules_.find(id);
+
+  if (p != rules_.end() && ! (*p).second->isDoubleColon()) {
+    std::cerr << "Target '" << lhs << "' has both : and :: entries\n";
+    return nullptr;
+  }
+
+  auto *rule = arena_.create<Rule>(&symbols_, id, rids);
+
+  rule->setDoubleColon(true);
+
+  if (isDebug()) {
+    std::cerr << "DEFINE DOUBLE COLON RULE: "; rule->print();
+  }
+
+  if (p != rules_.end()) {
+    auto *rule1 = (*p).second;
+
+    while (rule1->nextColon())
+      rule1 = rule1->nextColon();
+
+    rule1->setNextColon(rule);
+
+    return rule;
+  }
+
+  rules_[id] = rule;
+
+  if (! defRule_)
+    defRule_ = rule;
+
+  return rule;
+}
+
+CMake::Rule *
+CMake::
+getRule(SymbolId id) const
+{
+  if (isDebug())
+    std::cerr << "GET RULE: " << symbols_.name(id) << "\n";
+
+  auto p = rules_.find(id);
+
+  Rule *rule = (p != rules_.end() ? (*p).second : nullptr);
+
+  // explicit rule with commands (or double colon rules) does not use implicit rules
+  if (patternRules_.isEmpty() ||
+      (rule && (rule->hasCmds() || rule->isPhony() || rule->isDoubleColon())))
+    return rule;
+
+  // find (and remember) implicit rule. Not remembered while makefiles are
+  // read as rules and VPATH can still change.
+  if (parseDepth_ > 0) {
+    auto *implicitRule = findImplicitRule(id, rule);
+
+    return (implicitRule ? implicitRule : rule);
+  }
+
+  auto pi = implicitRules_.find(id);
+
+  if (pi == implicitRules_.end())
+    pi = implicitRules_.emplace(id, findImplicitRule(id, rule)).first;
+
+  if ((*pi).second)
+    return (*pi).second;
+
+  if (! rule && isDebug())
+    std::cerr << "not found\n";
+
+  return rule;
+}
+
+// define rule for each target sharing the prerequisites and commands of one
+// command rule (grouped targets are made together by one run of commands)
+CMake::Rule *
+CMake::
+defineMultiTargetRules(const WordViews &targets, const SymbolIds &rids,
+                       const SymbolIds &oids, bool grouped)
 {
-  if (isDebug())
-    std::cerr << "MAKE " << rule->lhs() << "\n";
+  if (targets.empty())
+    return nullptr;
 
-  rule->print();
+  auto *cmdRule = arena_.create<Rule>(&symbols_, symbols_.intern(targets[0]), rids);
 
-  if (outOfDate(rule->lhs(), rule->rwords())) {
-    for (const auto &rword : rule->rwords()) {
-      auto *rule1 = getRule(rword);
+  cmdRule->addOids(oids);
 
-      if (rule1)
-        make(rule1);
-    }
+  for (const auto &target : targets) {
+    // special targets and pattern rules use their own prerequisites
+    bool ownRids = (target[0] == '.' || target.find('%') != std::string_view::npos);
 
-    for (const auto &cmd : rule->cmds()) {
-      std::string cmd1 = replaceVariables(cmd->cmd());
+    // existing target has prerequisites merged and keeps its commands
+    bool exists = (rules_.find(symbols_.intern(target)) != rules_.end());
+
+    auto *rule = defineRule(std::string(target), ownRids || exists ? rids : SymbolIds());
+
+    if (! rule)
+      continue;
+
+    if (ownRids || exists)
+      rule->addOids(oids);
 
-      exec(cmd1, cmd->isSilent());
+    if (exists) {
+      if (! rule->hasCmds() && ! rule->cmdRule())
+        rule->setCmdRule(cmdRule);
+
+      continue;
     }
+
+    rule->setCmdRule(cmdRule, ! ownRids);
+
+    if (grouped && ! ownRids)
+      cmdRule->addGroupRule(rule);
   }
+
+  return cmdRule;
 }
 
-bool
+// define rules for each target of static pattern rule, all targets share
+// the returned command rule
+CMake::Rule *
 CMake::
-outOfDate(const std::string &lhs, const Words &rwords) const
+defineStaticPatternRules(const std::string &lhs, const std::string &targetPattern,
+                         const std::string &prereqPatterns)
 {
-  if (isDebug()) {
-    std::cerr << "CHECK OUT OF DATE: " << lhs;
+  auto targetPattern1 = replaceVariables(targetPattern);
 
-    for (const auto &rword : rwords)
-      std::cerr << " " << rword;
+  WordViews patternWords;
 
-    std::cerr << "\n";
+  splitWords(targetPattern1, patternWords);
+
+  if (patternWords.size() != 1 || patternWords[0].find('%') == std::string_view::npos) {
+    std::cerr << "Invalid target pattern '" << targetPattern1 << "'\n";
+    return nullptr;
   }
 
-  // if rhs files don't exist then need build
-  for (const auto &rword : rwords) {
-    if (! CFile::exists(rword)) {
-      if (isDebug())
-        std::cerr << "NOT EXIST : " << rword << "\n";
+  Pattern pattern(patternWords[0]);
 
-      return true;
+  // prereq-patterns | order only prereq-patterns
+  auto prereqPatterns1 = replaceVariables(prereqPatterns);
+
+  auto opos = prereqPatterns1.find('|');
+
+  WordViews prereqWords, orderWords;
+
+  splitWords(std::string_view(prereqPatterns1).substr(0, opos), prereqWords);
+
+  if (opos != std::string::npos)
+    splitWords(std::string_view(prereqPatterns1).substr(opos + 1), orderWords);
+
+  auto *cmdRule = arena_.create<Rule>(&symbols_, symbols_.intern(patternWords[0]));
+
+  WordViews targets;
+
+  splitWords(lhs, targets);
+
+  for (const auto &target : targets) {
+    std::string stem;
+
+    if (! pattern.match(target, stem)) {
+      std::cerr << "Target '" << target << "' doesn't match the target pattern\n";
+      continue;
     }
-  }
 
-  // if lhs file doesn't exist then need build
-  if (! CFile::exists(lhs)) {
-    if (isDebug())
-      std::cerr << "NOT EXIST : " << lhs << "\n";
+    SymbolIds rids, oids;
 
-    return true;
-  }
+    for (const auto &prereq : prereqWords)
+      rids.push_back(symbols_.intern(substitutePattern(prereq, stem)));
 
-  // get lhs time
-  int t1 = CFile::getMTime(lhs);
+    for (const auto &prereq : orderWords)
+      oids.push_back(symbols_.intern(substitutePattern(prereq, stem)));
 
-  // if any file on rhs is new than rhs then need build
-  for (const auto &rword : rwords) {
-    int t2 = CFile::getMTime(rword);
+    // existing target (e.g. from dependency file) gets pattern prerequisites
+    // first so $< is the first pattern prerequisite
+    auto pr = rules_.find(symbols_.intern(target));
 
-    if (t1 < t2) {
-      if (isDebug())
-        std::cerr << "NEWER : " << rword << "\n";
+    Rule *rule = nullptr;
 
-      return true;
+    if (pr != rules_.end()) {
+      rule = (*pr).second;
+
+      if (rule->isDoubleColon()) {
+        std::cerr << "Target '" << target << "' has both : and :: entries\n";
+        continue;
+      }
+
+      rule->addRids(rids, /*front*/true);
     }
+    else
+      rule = defineRule(std::string(target), rids);
+
+    if (! rule)
+      continue;
+
+    rule->addOids   (oids);
+    rule->setStem   (stem);
+    rule->setCmdRule(cmdRule);
   }
 
-  return false;
+  return cmdRule;
 }
 
+// check for compiler generated dependency file (.d)
 bool
 CMake::
-exec(const std::string &cmd, bool silent)
+isDepFile(const std::string &filename)
 {
-  if (isDebug())
-    std::cerr << "EXEC : " << cmd << "\n";
+  auto len = filename.size();
 
-  if (! silent)
-    std::cerr << cmd << "\n";
-
-  return COSProcess::executeCommand(cmd);
+  return (len > 2 && filename[len - 2] == '.' && filename[len - 1] == 'd');
 }
 
-std::string
+// parse dependency file (gcc -MD/-MP output) of 'targets: prerequisites'
+// lines without variable expansion or directive checks. Returns false
+// (nothing defined) if the file can't be read or has any other content so
+// it is processed as a normal makefile.
+bool
 CMake::
-replaceVariables(const std::string &str) const
+processDepFile(const std::string &filename)
 {
-  std::string str1;
+  CMakeLineReader reader;
 
-  CStrParse parse(str);
+  if (! reader.open(filename))
+    return false;
 
-  while (! parse.eof()) {
-    if (parse.isChar('$')) {
-      parse.skipChar();
+  struct DepLine {
+    SymbolIds targets;
+    SymbolIds rids;
+  };
 
-      if (parse.isChar('(')) {
-        parse.skipChar();
+  std::vector<DepLine> depLines;
 
-        std::string var;
+  std::string_view line;
 
-        while (! parse.eof() && ! parse.isChar(')'))
-          var += parse.readChar();
+  while (reader.nextLine(line)) {
+    auto i = line.find_first_not_of(' ');
 
-        if (parse.isChar(')'))
-          parse.skipChar();
+    if (i == std::string_view::npos || line[i] == '#')
+      continue;
 
-        if (isVariable(var)) {
-          CMake::Variable *var1 = getVariable(var);
+    // commands, variables, patterns, escapes etc. need full parser
+    if (line[0] == '\t' || line.find_first_of("$=%;|&\\") != std::string_view::npos)
+      return false;
 
-          str1 += var1->value;
-        }
-        else
-          str1 += "$(" + var + ")";
-      }
-      else {
-        str1 += '$';
-        str1 += parse.readChar();
-      }
-    }
-    else
-      str1 += parse.readChar();
+    auto pos = line.find(':');
+
+    if (pos == std::string_view::npos || line.find(':', pos + 1) != std::string_view::npos)
+      return false;
+
+    DepLine depLine;
+
+    CMakeForEachWord(line.substr(0, pos), [&](std::string_view word) {
+      depLine.targets.push_back(symbols_.intern(word));
+    });
+
+    CMakeForEachWord(line.substr(pos + 1), [&](std::string_view word) {
+      depLine.rids.push_back(symbols_.intern(word));
+    });
+
+    if (depLine.targets.empty())
+      return false;
+
+    depLines.push_back(std::move(depLine));
   }
 
-  return str1;
+  if (isDebug())
+    std::cerr << "DEPENDENCY FILE: " << filename << "\n";
+
+  makefiles_.push_back(symbols_.intern(filename));
+
+  for (const auto &depLine : depLines) {
+    for (const auto &target : depLine.targets)
+      addDependencies(target, depLine.rids);
+  }
+
+  return true;
 }
 
-CMake::Variable *
+// append prerequisites to target rule (created if needed)
+void
 CMake::
-defineVariable(const std::string &name, const std::string &value, bool deferred)
+addDependencies(SymbolId id, const SymbolIds &rids)
 {
-  if (isDebug())
-    std::cerr << "DEFINE VAR: " << name << "=" << value << "\n";
+  auto p = rules_.find(id);
 
-  auto p = variables_.find(name);
+  if (p != rules_.end()) {
+    (*p).second->addRids(rids);
+    return;
+  }
 
-  if (p == variables_.end()) {
-    Variable *var = new Variable(name, value, deferred);
+  auto *rule = arena_.create<Rule>(&symbols_, id, rids);
+
+  rules_[id] = rule;
+
+  implicitRules_.erase(id);
+
+  if (! defRule_ && symbols_.name(id)[0] != '.')
+    defRule_ = rule;
+}
+
+CMake::Rule *
+CMake::
+definePatternRule(const std::string &lhs, const SymbolIds &rids)
+{
+  auto *rule = arena_.create<Rule>(&symbols_, symbols_.intern(lhs), rids);
 
-    p = variables_.insert(p, Variables::value_type(name, var));
+  if (isDebug()) {
+    std::cerr << "DEFINE PATTERN RULE: "; rule->print();
   }
 
-  Variable *var = (*p).second;
+  patternRules_.add(rule, lhs);
 
-  var->value    = value;
-  var->deferred = deferred;
+  implicitRules_.clear();
 
-  return var;
+  return rule;
 }
 
+// check for suffix rule (.<prereq suffix><target suffix>) from known suffixes
 bool
 CMake::
-isVariable(const std::string &name) const
+isSuffixRule(const std::string &lhs, std::string &target, std::string &prereq) const
 {
-  auto p = variables_.find(name);
+  if (lhs.empty() || lhs[0] != '.')
+    return false;
 
-  if (p != variables_.end())
-    return true;
+  for (const auto &suffix : suffixes_) {
+    if (lhs.compare(0, suffix.size(), suffix) != 0)
+      continue;
 
-  auto ptr = getenv(name.c_str());
+    auto rest = lhs.substr(suffix.size());
 
-  if (ptr)
-    return true;
+    if (rest.empty() ||
+        std::find(suffixes_.begin(), suffixes_.end(), rest) != suffixes_.end()) {
+      target = rest;
+      prereq = suffix;
+
+      return true;
+    }
+  }
 
   return false;
 }
 
-CMake::Variable *
+// find first pattern rule matching target whose prerequisites exist or are
+// targets, and create rule for target using it (explicit prerequisites of
+// target are added)
+CMake::Rule *
 CMake::
-getVariable(const std::string &name) const
+findImplicitRule(SymbolId id, Rule *explicitRule) const
 {
-  auto p = variables_.find(name);
+  PatternIndex::Matches matches;
 
-  if (p != variables_.end())
-    return (*p).second;
+  patternRules_.match(symbols_.name(id), matches);
 
-  auto ptr = getenv(name.c_str());
+  for (const auto &match : matches) {
+    auto *prule = match.rule;
 
-  if (ptr) {
-    CMake *th = const_cast<CMake *>(this);
+    if (! prule->hasCmds())
+      continue;
+
+    SymbolIds rids;
+
+    bool found = true;
+
+    for (const auto &prid : prule->rids()) {
+      auto rid = symbols_.intern(substitutePattern(symbols_.name(prid), match.stem));
+
+      if (! fileStat(vpathFile(rid)).exists && rules_.find(rid) == rules_.end()) {
+        found = false;
+        break;
+      }
+
+      rids.push_back(rid);
+    }
+
+    if (! found)
+      continue;
+
+    SymbolIds oids;
 
-    return th->defineVariable(name, ptr, false);
+    for (const auto &poid : prule->oids())
+      oids.push_back(symbols_.intern(substitutePattern(symbols_.name(poid), match.stem)));
+
+    if (explicitRule) {
+      for (const auto &rid : explicitRule->rids()) {
+        if (std::find(rids.begin(), rids.end(), rid) == rids.end())
+          rids.push_back(rid);
+      }
+
+      oids.insert(oids.end(), explicitRule->oids().begin(), explicitRule->oids().end());
+    }
+
+    auto *th = const_cast<CMake *>(this);
+
+    auto *rule = th->arena_.create<Rule>(&symbols_, id, rids);
+
+    rule->addOids(oids);
+
+    rule->setStem   (match.stem);
+    rule->setCmdRule(prule);
+
+    if (isDebug()) {
+      std::cerr << "IMPLICIT RULE: "; rule->print();
+    }
+
+    return rule;
   }
 
   return nullptr;
 }
 
-CMake::Rule *
+// replace first '%' in pattern with stem
+std::string
 CMake::
-defineRule(const std::string &lhs, const Words &rwords)
+substitutePattern(std::string_view pattern, const std::string &stem)
 {
-  // .PHONY
-  // .SUFFIXES
-  // .DEFAULT
-  // .PRECIOUS
-  // .INTERMEDIATE
-  // .SECONDARY
-  // .SECONDEXPANSION
-  // .DELETE_ON_ERROR
-  // .IGNORE
-  // .LOW_RESOLUTION_TIME
-  // .SILENT
-  // .EXPORT_ALL_VARIABLES
-  // .NOTPARALLEL
-  // .ONESHELL
-  // .POSIX
+  auto pos = pattern.find('%');
 
-  if (lhs == ".PHONY") {
-    for (const auto &rword : rwords) {
-      Rule *rule = getRule(rword);
+  if (pos == std::string_view::npos)
+    return std::string(pattern);
 
-      if (rule)
-        rule->setPhony(true);
-    }
+  std::string str;
 
-    return nullptr;
-  }
+  str.reserve(pattern.size() + stem.size());
 
-  auto *rule = new Rule(lhs, rwords);
+  str.append(pattern.data(), pos);
+  str.append(stem);
+  str.append(pattern.data() + pos + 1, pattern.size() - pos - 1);
 
-  if (isDebug()) {
-    std::cerr << "DEFINE RULE: "; rule->print();
+  return str;
+}
+
+// process conditional directive line (returns false if not conditional)
+//  ifdef variable
+//  ifndef variable
+//  ifeq (a,b) | ifeq "a" "b" | ifeq 'a' 'b'
+//  ifneq (a,b) | ifneq "a" "b" | ifneq 'a' 'b'
+//  else [conditional]
+//  endif
+bool
+CMake::
+processConditional(std::string_view line)
+{
+  // tab line is rule command
+  if (line.empty() || line[0] == '\t')
+    return false;
+
+  size_t i   = 0;
+  auto   len = line.size();
+
+  while (i < len && (line[i] == ' ' || line[i] == '\t'))
+    ++i;
+
+  auto isCondKeyword = [](std::string_view keyword) {
+    return (keyword == "ifdef" || keyword == "ifndef" ||
+            keyword == "ifeq"  || keyword == "ifneq");
+  };
+
+  auto keyword = CMakeReadKeyword(line, i);
+
+  if (keyword.empty())
+    return false;
+
+  bool active = isBlockActive();
+
+  if      (isCondKeyword(keyword)) {
+    if (isDebug() && active)
+      std::cerr << "Line: " << line << "\n";
+
+    // no need to evaluate inside inactive block
+    if (active)
+      startBlock(evalConditional(keyword, line.substr(i)));
+    else
+      startBlock(false);
   }
+  else if (keyword == "else") {
+    if (blocks_.empty()) {
+      std::cerr << "else without if\n";
+      return true;
+    }
 
-  rules_[lhs] = rule;
+    const auto &block = blocks_.back();
 
-  if (lhs[0] != '.') {
-    if (! defRule_)
-      defRule_ = rule;
+    bool b = true;
+
+    // else ifeq ...
+    if (i < len && line[i] != '#') {
+      auto keyword1 = CMakeReadKeyword(line, i);
+
+      if (! isCondKeyword(keyword1)) {
+        std::cerr << "Bad else: " << line << "\n";
+        return true;
+      }
+
+      b = (block.parentActive && ! block.taken && evalConditional(keyword1, line.substr(i)));
+    }
+
+    elseBlock(b);
   }
+  else if (keyword == "endif") {
+    endBlock();
+  }
+  else
+    return false;
 
-  return rule;
+  return true;
 }
 
-CMake::Rule *
+// evaluate conditional directive args
+bool
 CMake::
-getRule(const std::string &name) const
+evalConditional(std::string_view name, std::string_view args) const
 {
-  if (isDebug())
-    std::cerr << "GET RULE: " << name << "\n";
+  auto strip = [](std::string_view str) {
+    while (! str.empty() && isspace(static_cast<unsigned char>(str.front())))
+      str.remove_prefix(1);
 
-  auto p = rules_.find(name);
+    while (! str.empty() && isspace(static_cast<unsigned char>(str.back())))
+      str.remove_suffix(1);
 
-  if (p != rules_.end())
-    return (*p).second;
+    return str;
+  };
 
-  if (isDebug())
-    std::cerr << "not found\n";
+  if (name == "ifdef" || name == "ifndef") {
+    auto pos = args.find('#');
 
-  return nullptr;
+    auto value = replaceVariables(std::string(strip(args.substr(0, pos))));
+
+    bool b = isVariable(value);
+
+    return (name == "ifdef" ? b : ! b);
+  }
+
+  // get two args
+  std::string_view arg1, arg2;
+
+  bool valid = false;
+
+  if      (! args.empty() && args[0] == '(') {
+    // (a,b) : split at top level comma
+    int depth = 0;
+
+    for (size_t i = 1; i < args.size(); ++i) {
+      char c = args[i];
+
+      if      (c == '(' || c == '{')
+        ++depth;
+      else if (c == ')' || c == '}') {
+        if (depth == 0) {
+          if (! arg1.data())
+            break;
+
+          arg2  = strip(args.substr(arg1.size() + 2, i - arg1.size() - 2));
+          valid = true;
+          break;
+        }
+
+        --depth;
+      }
+      else if (c == ',' && depth == 0 && ! arg1.data())
+        arg1 = args.substr(1, i - 1);
+    }
+
+    arg1 = strip(arg1);
+  }
+  else if (! args.empty() && (args[0] == '"' || args[0] == '\'')) {
+    // "a" "b" or 'a' 'b'
+    auto readQuoted = [&](std::string_view &str, std::string_view &arg) {
+      str = strip(str);
+
+      if (str.empty() || (str[0] != '"' && str[0] != '\''))
+        return false;
+
+      auto pos = str.find(str[0], 1);
+
+      if (pos == std::string_view::npos)
+        return false;
+
+      arg = str.substr(1, pos - 1);
+      str = str.substr(pos + 1);
+
+      return true;
+    };
+
+    auto str = args;
+
+    valid = (readQuoted(str, arg1) && readQuoted(str, arg2));
+  }
+
+  if (! valid) {
+    std::cerr << "Invalid conditional: " << name << " " << args << "\n";
+    return false;
+  }
+
+  bool b = (replaceVariables(std::string(arg1)) == replaceVariables(std::string(arg2)));
+
+  return (name == "ifeq" ? b : ! b);
 }
 
 void
 CMake::
 startBlock(bool b)
 {
-  blocks_.push_back(Block(b));
+  bool parentActive = isBlockActive();
+
+  blocks_.push_back(Block(parentActive && b, parentActive));
+}
+
+// switch to else branch (only active if no previous branch taken)
+void
+CMake::
+elseBlock(bool b)
+{
+  auto &block = blocks_.back();
+
+  block.active = (block.parentActive && ! block.taken && b);
+
+  if (block.active)
+    block.taken = true;
 }
 
 void
@@ -2,16 +2,38 @@
 #define CMake_H
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <deque>
+#include <unordered_map>
+#include <algorithm>
+#include <mutex>
 #include <iostream>
+#include <unordered_set>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <tuple>
 
 class CMake {
+ private:
+  class Expansion;
+  class AutoVars;
+  struct FunctionDef;
+
  public:
   struct Variable {
     std::string name;
     std::string value;
     bool        deferred { false };
+    bool        env      { false }; // defined from environment
+    bool        cmdLine  { false }; // defined on command line (needs override)
+
+    // cached compiled value (deferred variables) and recursion guard
+    std::shared_ptr<Expansion> expansion;
+    bool                       expanding { false };
 
     Variable(const std::string &name="", const std::string &value="", bool deferred=false) :
      name(name), value(value), deferred(deferred) {
@@ -21,53 +43,602 @@ class CMake {
  public:
   CMake();
 
+  CMake(const CMake &) = delete;
+  CMake &operator=(const CMake &) = delete;
+
   bool isQuiet() const { return quiet_; }
   void setQuiet(bool b) { quiet_ = b; }
 
   bool isDebug() const { return debug_; }
   void setDebug(bool b) { debug_ = b; }
 
+  int numJobs() const { return numJobs_; }
+  void setNumJobs(int n) { numJobs_ = std::max(n, 1); }
+
+  bool isKeepGoing() const { return keepGoing_; }
+  void setKeepGoing(bool b) { keepGoing_ = b; }
+
   bool processFile(const std::string &filename, bool silent=false);
 
-  void make();
-  void make(const std::string &name);
+  bool loadParseCache(const std::string &filename, const std::string &makefile);
+  bool saveParseCache(const std::string &filename, const std::string &makefile);
+
+  bool isBuildDb() const { return ! buildDbFile_.empty(); }
+
+  // content hash mode (inputs with new times but same contents are unchanged)
+  bool isContentHash() const { return contentHash_; }
+  void setContentHash(bool b) { contentHash_ = b; }
+
+  bool loadBuildDb(const std::string &filename);
+  bool saveBuildDb();
+
+  // persistent #include scan results (.SCAN_INCLUDES)
+  void setIncludeCacheFile(const std::string &filename) { includeCacheFile_ = filename; }
+
+  bool saveIncludeCache();
+
+  // local artifact cache (outputs of commands stored by key of their inputs)
+  bool isArtifactCache() const { return ! artifactDir_.empty(); }
+
+  void setArtifactCache(const std::string &dir, uint64_t maxSize, bool link=false);
+
+  bool saveArtifactStats(bool print);
+
+  bool make();
+  bool make(const std::string &name);
 
   Variable *getVariable(const std::string &name) const;
 
+  // set variable from command line (NAME=value)
+  void setCommandLineVariable(const std::string &name, const std::string &value);
+
  private:
   class Rule;
 
-  using Words = std::vector<std::string>;
+  using WordViews = std::vector<std::string_view>;
+
+  using SymbolId  = uint32_t;
+  using SymbolIds = std::vector<SymbolId>;
+
+  static constexpr SymbolId NO_SYMBOL = SymbolId(-1);
 
  private:
-  void stringToFiles(const std::string &str, Words &words);
-  void stringToWords(const std::string &str, Words &words);
+  void wordsToSymbols(std::string_view str, SymbolIds &ids);
+
+  static void splitWords(std::string_view str, WordViews &words);
 
   std::string replaceVariables(const std::string &str) const;
 
+  void compileExpansion(std::string_view str, Expansion &expansion) const;
+
+  void expandTo(const Expansion &expansion, std::string &str,
+                const AutoVars *autoVars=nullptr) const;
+
+  void expandVariable(SymbolId id, std::string &str, const AutoVars *autoVars=nullptr) const;
+
+  static bool isAutoVariable(std::string_view name);
+
+  //---
+
+  // builtin functions ($(name args))
+  using FunctionArgs = std::vector<std::shared_ptr<Expansion>>;
+
+  using FunctionProc =
+    void (CMake::*)(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+
+  struct FunctionDef {
+    FunctionProc proc    { nullptr };
+    int          minArgs { 0 };
+    int          maxArgs { 0 };
+  };
+
+  static const FunctionDef *lookupFunction(std::string_view name);
+
+  void compileFunction(const FunctionDef *func, std::string_view name,
+                       std::string_view argsStr, Expansion &expansion) const;
+
+  std::string expandArg(const FunctionArgs &args, size_t i, const AutoVars *autoVars) const;
+
+  void funcSubst     (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcPatSubst  (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcStrip     (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcFindString(const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcFilter    (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcFilterOut (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcSort      (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcWord      (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcWordList  (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcWords     (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcFirstWord (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcLastWord  (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcDir       (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcNotDir    (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcBaseName  (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcAddPrefix (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcAddSuffix (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcWildcard  (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcForEach   (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcIf        (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcCall      (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+  void funcShell     (const FunctionArgs &args, std::string &str, const AutoVars *autoVars) const;
+
+  void filterWords(const FunctionArgs &args, std::string &str,
+                   const AutoVars *autoVars, bool keep) const;
+
+  // temporarily set variable value (foreach and call)
+  struct SavedVariable {
+    SymbolId  id      { NO_SYMBOL };
+    Variable* var     { nullptr };
+    bool      defined { false };
+    Variable  value;
+  };
+
+  SavedVariable pushVariable(SymbolId id) const;
+  void setTempVariable(const SavedVariable &saved, const std::string &value) const;
+  void popVariable(const SavedVariable &saved) const;
+
   Variable *defineVariable(const std::string &name, const std::string &value, bool deferred);
 
+  void appendVariable(Variable *var, const std::string &value);
+
+  // assign variable using op (=, :=, ::=, +=, ?= or !=)
+  Variable *assignVariable(const std::string &name, const std::string &op,
+                           const std::string &value, bool override=false);
+
+  void undefineVariable(const std::string &name, bool override=false);
+
+  // define/endef block being read
+  struct Define {
+    std::string name;
+    std::string op;
+    std::string value;
+    int         depth    { 0 };
+    int         lines    { 0 };
+    bool        active   { false };
+    bool        override { false };
+    bool        exported { false };
+  };
+
+  void processModifiers(std::string_view keyword, std::string_view rest, Define &define);
+
+  void startDefine(std::string_view rest, Define &define, bool override, bool exported);
+
+  void processDefineLine(std::string_view line, Define &define);
+
+  static bool isDefineLine(std::string_view line);
+
+  void setExported(const std::string &names, bool exported);
+
+  // environment for commands (process environment updated with exported
+  // variables). Rebuilt only when an exported variable changes.
+  struct CommandEnv {
+    std::vector<std::string> strs;
+    std::vector<char *>      envp;
+    uint64_t                 envHash { 0 }; // hash of strs
+    uint64_t                 keyHash { 0 }; // hash of strs used in artifact key
+  };
+
+  using CommandEnvP = std::shared_ptr<const CommandEnv>;
+
+  bool isExported(SymbolId id, const Variable *var) const;
+
+  CommandEnvP commandEnv() const;
+
+  char *const *commandEnvp(const CommandEnvP &env) const;
+
   bool isVariable(const std::string &name) const;
 
-  Rule *defineRule(const std::string &lhs, const Words &rwords);
+  Variable *getVariable(SymbolId id) const;
+
+  const char *lookupEnv(const std::string &name) const;
+
+  Rule *defineRule(const std::string &lhs, const SymbolIds &rids);
+
+  Rule *defineDoubleColonRule(const std::string &lhs, const SymbolIds &rids);
+
+  Rule *getRule(SymbolId id) const;
+
+  void parseRuleLine(const std::string &lhs, const std::string &rhs);
+
+  static size_t findRuleColon(std::string_view str);
+
+  void startRuleCmds(Rule *rule);
+
+  static bool isDepFile(const std::string &filename);
 
-  Rule *getRule(const std::string &name) const;
+  bool processDepFile(const std::string &filename);
+
+  void addDependencies(SymbolId id, const SymbolIds &rids);
+
+  Rule *defineMultiTargetRules(const WordViews &targets, const SymbolIds &rids,
+                                const SymbolIds &oids, bool grouped);
+
+  Rule *defineStaticPatternRules(const std::string &lhs, const std::string &targetPattern,
+                                 const std::string &prereqPatterns);
+
+  Rule *definePatternRule(const std::string &lhs, const SymbolIds &rids);
+
+  bool isSuffixRule(const std::string &lhs, std::string &target, std::string &prereq) const;
+
+  Rule *findImplicitRule(SymbolId id, Rule *explicitRule) const;
+
+  static std::string substitutePattern(std::string_view pattern, const std::string &stem);
 
   Rule *defRule() const { return defRule_; }
 
+  bool processConditional(std::string_view line);
+
+  bool evalConditional(std::string_view name, std::string_view args) const;
+
   void startBlock(bool b);
+  void elseBlock(bool b);
   void endBlock();
 
   bool isBlockActive() const;
 
-  void make(Rule *rule);
+  bool make(Rule *rule);
+
+  bool makeSerial(Rule *rule);
+  bool makeSerialRule(Rule *rule);
+  bool makeParallel(Rule *rule);
+
+  enum class TargetState {
+    UNVISITED,
+    IN_PROGRESS,
+    UP_TO_DATE,
+    REBUILT,
+    FAILED
+  };
+
+  TargetState targetState(const Rule *rule) const;
+  void setTargetState(const Rule *rule, TargetState state);
+
+  bool isTargetDone(TargetState state) const {
+    return (state == TargetState::UP_TO_DATE || state == TargetState::REBUILT ||
+            state == TargetState::FAILED);
+  }
+
+  void circularDependency(const std::vector<const Rule *> &chain, const Rule *rule) const;
+
+  bool needsBuild(Rule *rule);
+
+  bool targetNeedsBuild(Rule *rule);
+
+  bool outOfDate(SymbolId lhs, const SymbolIds &rids) const;
+
+  // #include dependencies of C/C++ prerequisites (.SCAN_INCLUDES)
+  struct Include {
+    std::string name;
+    bool        angle { false }; // <name> (not searched in including file's dir)
+  };
+
+  using Includes    = std::vector<Include>;
+  using IncludeDirs = std::vector<std::string>;
+
+  bool isScanIncludes() const { return scanIncludes_; }
+
+  bool isScanFile(SymbolId id) const;
+
+  const Includes &fileIncludes(SymbolId id);
+
+  void loadIncludeCache();
+
+  const IncludeDirs &ruleIncludeDirs(Rule *rule) const;
+
+  SymbolId resolveInclude(SymbolId from, const Include &include, const IncludeDirs &dirs);
+
+  void includeDeps(Rule *rule, SymbolIds &deps);
+
+  bool includesOutOfDate(Rule *rule);
+
+  void ruleGeneratedIncludes(Rule *rule, std::vector<Rule *> &rules);
+
+  void ruleInputs(Rule *rule, SymbolIds &ids);
+
+  // file modification time in nanoseconds since the epoch
+  using FileTime = int64_t;
+
+  struct FileStat {
+    bool     valid  { false };
+    bool     exists { false };
+    FileTime mtime  { 0 };
+    bool     hashed { false };
+    uint64_t hash   { 0 };
+  };
+
+  bool isLowResolutionTime(SymbolId id) const;
+
+  FileStat fileStat(SymbolId id) const;
+
+  void invalidateFileStat(SymbolId id);
+
+  // content hash of file (computed once per run, 0 if not readable)
+  uint64_t fileHash(SymbolId id) const;
+
+  // cached directory contents (sorted by name, one scan per directory per run)
+  struct DirEntry {
+    std::string name;
+    bool        isDir { false };
+  };
+
+  struct DirListing {
+    using Entries = std::vector<DirEntry>;
+
+    bool    exists { false };
+    Entries entries;
+
+    bool contains(std::string_view name) const;
+  };
+
+  const DirListing &dirListing(std::string_view dir) const;
+
+  void globFiles(std::string_view pattern, std::vector<std::string> &files) const;
+
+  // vpath search for prerequisites
+  void addVPath(const std::string &pattern, const std::string &dirs);
+
+  SymbolId vpathFile(SymbolId id) const;
+
+  struct ExecCmd {
+    std::string cmd;
+    bool        silent { false };
+    bool        ignore { false };
+    CommandEnvP env;
+  };
+
+  using ExecCmds = std::vector<ExecCmd>;
+
+  void expandCmds(Rule *rule, ExecCmds &execCmds) const;
+
+  void buildCmds(Rule *rule, ExecCmds &execCmds);
+
+  static uint64_t hashString(std::string_view str, uint64_t hash=0xcbf29ce484222325ULL);
+
+  static uint64_t hashStrings(std::vector<std::string_view> strs);
+
+  static uint64_t environHash();
+
+  static uint64_t hashCmds(const ExecCmds &execCmds);
+
+  bool buildDbOutOfDate(Rule *rule);
+
+  struct BuildRecord;
 
-  bool outOfDate(const std::string &lhs, const Words &rwords) const;
+  bool inputsChanged(Rule *rule, BuildRecord &record);
 
-  bool exec(const std::string &cmd, bool silent=false);
+  bool inputsUnchanged(Rule *rule);
+
+  void updateBuildRecord(Rule *rule, const ExecCmds &execCmds);
+
+  uint64_t buildDbEnvHash() const;
+
+  void ruleBuilt(Rule *rule, const ExecCmds &execCmds, bool rc);
+
+  bool runCmds(const ExecCmds &execCmds);
+
+  // artifact cache counts (run or total)
+  struct ArtifactStats {
+    uint64_t hits      { 0 };
+    uint64_t misses    { 0 };
+    uint64_t stores    { 0 };
+    uint64_t evictions { 0 };
+    int64_t  size      { 0 }; // bytes
+  };
+
+  bool artifactKey(Rule *rule, const ExecCmds &execCmds, std::string &key);
+
+  std::string artifactEntry(const std::string &key) const;
+
+  bool restoreArtifacts(Rule *rule, const ExecCmds &execCmds);
+
+  void storeArtifacts(Rule *rule);
+
+  void evictArtifacts(ArtifactStats &stats);
+
+  bool exec(const std::string &cmd, char *const *envp, bool silent=false);
+
+  // run command for $(shell) and != (cached if marked pure by .SHELL_CACHE)
+  std::string shellCommand(const std::string &cmd) const;
+
+  bool isPureShellCommand(const std::string &cmd) const;
+
+  bool runCapture(const std::string &cmd, std::string &output, int &status) const;
 
  private:
-  using Variables = std::map<std::string,Variable *>;
+  using Variables = std::unordered_map<SymbolId,Variable *>;
+
+  // bump allocator for Rule and Variable objects which live as long as the
+  // CMake. Objects are allocated from large blocks and destroyed (in reverse
+  // order) when the arena is destroyed.
+  class Arena {
+   public:
+    Arena() { }
+
+   ~Arena() {
+      for (auto p = dtors_.rbegin(); p != dtors_.rend(); ++p)
+        (*p).destroy((*p).ptr);
+    }
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    template<typename T, typename... Args>
+    T *create(Args&&... args) {
+      void *mem = allocate(sizeof(T), alignof(T));
+
+      T *t = new (mem) T(std::forward<Args>(args)...);
+
+      if (! std::is_trivially_destructible<T>::value)
+        dtors_.push_back(Dtor { t, [](void *ptr) { static_cast<T *>(ptr)->~T(); } });
+
+      return t;
+    }
+
+   private:
+    void *allocate(size_t size, size_t align) {
+      size_t pos = (pos_ + align - 1) & ~(align - 1);
+
+      if (blocks_.empty() || pos + size > blockSize_) {
+        size_t blockSize = std::max(size + align, size_t(BLOCK_SIZE));
+
+        blocks_.emplace_back(new char [blockSize]);
+
+        blockSize_ = blockSize;
+
+        auto addr = reinterpret_cast<uintptr_t>(blocks_.back().get());
+
+        pos = ((addr + align - 1) & ~uintptr_t(align - 1)) - addr;
+      }
+
+      void *mem = blocks_.back().get() + pos;
+
+      pos_ = pos + size;
+
+      return mem;
+    }
+
+   private:
+    enum { BLOCK_SIZE = 64*1024 };
+
+    struct Dtor {
+      void *ptr;
+      void (*destroy)(void *);
+    };
+
+    using Blocks = std::vector<std::unique_ptr<char []>>;
+    using Dtors  = std::vector<Dtor>;
+
+    Blocks blocks_;
+    size_t blockSize_ { 0 };
+    size_t pos_       { 0 };
+    Dtors  dtors_;
+  };
+
+  // interned string table for target, prerequisite and variable names
+  // (one copy of each string, ids are stable for the life of the table)
+  class Symbols {
+   public:
+    Symbols() { }
+
+    SymbolId intern(std::string_view str) {
+      auto p = ids_.find(str);
+
+      if (p != ids_.end())
+        return (*p).second;
+
+      auto id = SymbolId(names_.size());
+
+      names_.emplace_back(str);
+
+      ids_.emplace(std::string_view(names_.back()), id);
+
+      return id;
+    }
+
+    SymbolId lookup(std::string_view str) const {
+      auto p = ids_.find(str);
+
+      if (p == ids_.end())
+        return NO_SYMBOL;
+
+      return (*p).second;
+    }
+
+    const std::string &name(SymbolId id) const { return names_[id]; }
+
+    size_t size() const { return names_.size(); }
+
+   private:
+    using Names = std::deque<std::string>;
+    using Ids   = std::unordered_map<std::string_view,SymbolId>;
+
+    Names names_;
+    Ids   ids_;
+  };
+
+  // string compiled into literal text and variable references so it can be
+  // expanded repeatedly without being reparsed
+  class Expansion {
+   public:
+    enum class PartType {
+      TEXT,
+      VARIABLE,
+      AUTO,
+      FUNCTION
+    };
+
+    using ExpansionP = std::shared_ptr<Expansion>;
+    using Args       = std::vector<ExpansionP>;
+
+    struct Part {
+      PartType            type { PartType::TEXT };
+      std::string         text;               // literal text, variable or function name
+      SymbolId            id   { NO_SYMBOL }; // variable name id
+      ExpansionP          nameExp;            // computed variable name ($($(X)_Y))
+      const FunctionDef*  func { nullptr };   // function
+      Args                args;               // function args
+    };
+
+    using Parts = std::vector<Part>;
+
+   public:
+    Expansion() { }
+
+    const Parts &parts() const { return parts_; }
+
+    bool isEmpty() const { return parts_.empty(); }
+
+    void addText(std::string_view text) {
+      if (text.empty())
+        return;
+
+      if (! parts_.empty() && parts_.back().type == PartType::TEXT)
+        parts_.back().text.append(text.data(), text.size());
+      else {
+        Part part;
+
+        part.text = std::string(text);
+
+        parts_.push_back(std::move(part));
+      }
+    }
+
+    void addAuto(std::string_view name) {
+      Part part;
+
+      part.type = PartType::AUTO;
+      part.text = std::string(name);
+
+      parts_.push_back(std::move(part));
+    }
+
+    Part &addFunction(std::string_view name, const FunctionDef *func) {
+      Part part;
+
+      part.type = PartType::FUNCTION;
+      part.text = std::string(name);
+      part.func = func;
+
+      parts_.push_back(std::move(part));
+
+      return parts_.back();
+    }
+
+    Part &addVariable(std::string_view name, SymbolId id) {
+      Part part;
+
+      part.type = PartType::VARIABLE;
+      part.text = std::string(name);
+      part.id   = id;
+
+      parts_.push_back(std::move(part));
+
+      return parts_.back();
+    }
+
+   private:
+    Parts parts_;
+  };
 
   class Cmd {
    public:
@@ -77,6 +648,9 @@ class CMake {
 
     const std::string &cmd() const { return cmd_; }
 
+    const std::shared_ptr<Expansion> &expansion() const { return expansion_; }
+    void setExpansion(const std::shared_ptr<Expansion> &expansion) { expansion_ = expansion; }
+
     bool isSilent() const { return silent_; }
     void setSilent(bool b) { silent_ = b; }
 
@@ -93,85 +667,460 @@ class CMake {
     }
 
    private:
-    std::string cmd_;
-    bool        silent_ { false };
-    bool        ignore_ { false };
+    std::string                cmd_;
+    bool                       silent_ { false };
+    bool                       ignore_ { false };
+    std::shared_ptr<Expansion> expansion_;
   };
 
-  using Cmds = std::vector<Cmd *>;
+  using Cmds = std::vector<Cmd>;
 
   class Rule {
    public:
-    Rule(const std::string &lhs="", const Words &rwords=Words()) :
-     lhs_(lhs), rwords_(rwords) {
+    Rule(const Symbols *symbols, SymbolId lhs, const SymbolIds &rids=SymbolIds()) :
+     symbols_(symbols), lhs_(lhs), rids_(rids) {
     }
 
-   ~Rule() {
-      for (auto &cmd : cmds_)
-        delete cmd;
+    Cmd &addCmd(const std::string &cmdStr) {
+      if (cmdRule_)
+        return cmdRule_->addCmd(cmdStr);
+
+      cmds_.emplace_back(cmdStr);
+
+      return cmds_.back();
     }
 
-    Cmd *addCmd(const std::string &cmdStr) {
-      auto *cmd = new Cmd(cmdStr);
+    SymbolId lhsId() const { return lhs_; }
+
+    const std::string &lhs() const { return symbols_->name(lhs_); }
 
-      cmds_.push_back(cmd);
+    // prerequisites (shared with command rule for multiple target rule)
+    const SymbolIds &rids() const { return (shareRids_ ? cmdRule_->rids_ : rids_); }
 
-      return cmd;
+    bool isShareRids() const { return shareRids_; }
+
+    // order only prerequisites (after '|') are made first but don't make the
+    // target out of date (shared like prerequisites)
+    const SymbolIds &oids() const { return (shareRids_ ? cmdRule_->oids_ : oids_); }
+
+    void addOids(const SymbolIds &oids) {
+      if (oids.empty())
+        return;
+
+      unshareRids();
+
+      oids_.insert(oids_.end(), oids.begin(), oids.end());
     }
 
-    const std::string &lhs() const { return lhs_; }
+    // add prerequisites from another rule line for target
+    void addRids(const SymbolIds &rids, bool front=false) {
+      if (rids.empty())
+        return;
 
-    const Words &rwords() { return rwords_; }
+      unshareRids();
 
-    const Cmds &cmds() { return cmds_; }
+      rids_.insert(front ? rids_.begin() : rids_.end(), rids.begin(), rids.end());
+    }
+
+    // use own (empty) commands instead of previous or shared commands
+    void detachCmds() {
+      unshareRids();
+
+      cmdRule_ = nullptr;
+
+      cmds_.clear();
+    }
+
+    // commands (shared with command rule if set)
+    Cmds &cmds() { return (cmdRule_ ? cmdRule_->cmds() : cmds_); }
+    const Cmds &cmds() const { return (cmdRule_ ? cmdRule_->cmds() : cmds_); }
+
+    bool hasCmds() const { return ! cmds().empty(); }
+
+    // rule which owns commands (pattern rule, static pattern rule or
+    // multiple target rule)
+    Rule *cmdRule() const { return cmdRule_; }
+
+    void setCmdRule(Rule *rule, bool shareRids=false) {
+      cmdRule_   = rule;
+      shareRids_ = (rule && shareRids);
+    }
+
+    // grouped targets (a b &: ...) are stored on command rule and are all
+    // made by one run of the commands (first rule represents group)
+    using Group = std::vector<Rule *>;
+
+    bool isGrouped() const { return (cmdRule_ && ! cmdRule_->group_.empty()); }
+
+    const Group &group() const { return cmdRule_->group_; }
+
+    void addGroupRule(Rule *rule) { group_.push_back(rule); }
+
+    const Group &groupRules() const { return group_; }
+
+    Rule *groupLeader() { return (isGrouped() ? group().front() : this); }
+    const Rule *groupLeader() const { return (isGrouped() ? group().front() : this); }
+
+    // pattern stem ($*)
+    const std::string &stem() const { return stem_; }
+    void setStem(const std::string &stem) { stem_ = stem; }
 
     bool isPhony() const { return phony_; }
     void setPhony(bool b) { phony_ = b; }
 
+    // double colon rules (target :: prerequisites) of a target are separate
+    // rules chained from the first (made in order)
+    bool isDoubleColon() const { return doubleColon_; }
+    void setDoubleColon(bool b) { doubleColon_ = b; }
+
+    Rule *nextColon() const { return nextColon_; }
+    void setNextColon(Rule *rule) { nextColon_ = rule; }
+
     //---
 
     void print() const {
       std::cerr << lhs() << ":";
 
-      for (const auto &word : rwords_)
-        std::cerr << " " << word;
+      for (const auto &rid : rids())
+        std::cerr << " " << symbols_->name(rid);
+
+      if (! oids().empty()) {
+        std::cerr << " |";
+
+        for (const auto &oid : oids())
+          std::cerr << " " << symbols_->name(oid);
+      }
 
       std::cerr << "\n";
 
-      for (const auto &cmd : cmds_) {
+      for (const auto &cmd : cmds()) {
         std::cerr << "\t";
 
-        cmd->print();
+        cmd.print();
       }
     }
 
    private:
-    std::string lhs_;
-    Words       rwords_;
-    Cmds        cmds_;
-    bool        phony_ { false };
+    void unshareRids() {
+      if (shareRids_) {
+        rids_      = cmdRule_->rids_;
+        oids_      = cmdRule_->oids_;
+        shareRids_ = false;
+      }
+    }
 
+   private:
+    const Symbols* symbols_ { nullptr };
+    SymbolId       lhs_     { NO_SYMBOL };
+    SymbolIds      rids_;
+    SymbolIds      oids_;
+    Cmds           cmds_;
+    Rule*          cmdRule_   { nullptr };
+    bool           shareRids_ { false };
+    Group          group_;
+    std::string    stem_;
+    bool           phony_     { false };
+    bool           doubleColon_ { false };
+    Rule*          nextColon_   { nullptr };
   };
 
-  using Rules = std::map<std::string,Rule *>;
+  using Rules     = std::unordered_map<SymbolId,Rule *>;
+  using RuleArray = std::vector<Rule *>;
+
+  // automatic variables ($@, $<, $^, $+, $?, $* and their D/F forms) for
+  // a rule's commands. Values are computed when referenced ($? uses the
+  // cached file times from the out of date check).
+  class AutoVars {
+   public:
+    AutoVars(const CMake *make, const Rule *rule) :
+     make_(make), rule_(rule) {
+    }
+
+    void expand(std::string_view name, std::string &str) const;
+
+   private:
+    void addWords(const SymbolIds &ids, char mod, std::string &str) const;
+
+    void addWord(std::string_view word, char mod, std::string &str) const;
+
+    const SymbolIds &uniqueIds() const;
+    const SymbolIds &newerIds() const;
+
+   private:
+    const CMake*      make_ { nullptr };
+    const Rule*       rule_ { nullptr };
+    mutable bool      uniqueSet_ { false };
+    mutable SymbolIds uniqueIds_;
+    mutable bool      newerSet_ { false };
+    mutable SymbolIds newerIds_;
+  };
+
+  // pattern (prefix%suffix) split into prefix and suffix
+  struct Pattern {
+    std::string prefix;
+    std::string suffix;
+    bool        hasDir { false }; // pattern contains '/' (match full name)
+
+    Pattern(std::string_view str="") {
+      auto pos = str.find('%');
+
+      prefix = std::string(str.substr(0, pos));
+      suffix = (pos != std::string_view::npos ? std::string(str.substr(pos + 1)) : "");
+      hasDir = (str.find('/') != std::string_view::npos);
+    }
+
+    // match name to pattern and return stem
+    bool match(std::string_view name, std::string &stem) const {
+      size_t dirLen = 0;
+
+      // pattern without directory matches file part (directory is added to stem)
+      if (! hasDir) {
+        auto pos = name.rfind('/');
+
+        if (pos != std::string_view::npos)
+          dirLen = pos + 1;
+      }
+
+      auto base = name.substr(dirLen);
+
+      if (base.size() <= prefix.size() + suffix.size())
+        return false;
+
+      if (base.compare(0, prefix.size(), prefix) != 0 ||
+          base.compare(base.size() - suffix.size(), suffix.size(), suffix) != 0)
+        return false;
+
+      stem  = std::string(name.substr(0, dirLen));
+      stem += base.substr(prefix.size(), base.size() - prefix.size() - suffix.size());
+
+      return true;
+    }
+  };
+
+  // index of pattern rules by pattern suffix so only patterns with a
+  // matching suffix are checked for a target
+  class PatternIndex {
+   public:
+    struct Match {
+      Rule*       rule { nullptr };
+      std::string stem;
+    };
+
+    using Matches = std::vector<Match>;
+
+   public:
+    PatternIndex() { }
+
+    bool isEmpty() const { return rules_.empty(); }
+
+    const RuleArray &rules() const { return rules_; }
+
+    void add(Rule *rule, std::string_view patternStr) {
+      Pattern pattern(patternStr);
+
+      auto len = pattern.suffix.size();
+
+      auto &entries = bySuffix_[pattern.suffix];
+
+      entries.emplace_back(pattern, rule, int(rules_.size()));
 
+      if (std::find(suffixLens_.begin(), suffixLens_.end(), len) == suffixLens_.end()) {
+        suffixLens_.push_back(len);
+
+        std::sort(suffixLens_.begin(), suffixLens_.end());
+      }
+
+      rules_.push_back(rule);
+    }
+
+    // get matching rules (shortest stem first, then in definition order)
+    void match(std::string_view name, Matches &matches) const {
+      std::vector<std::pair<int,Match>> matches1;
+
+      for (auto len : suffixLens_) {
+        if (len >= name.size())
+          break;
+
+        auto p = bySuffix_.find(std::string(name.substr(name.size() - len)));
+
+        if (p == bySuffix_.end())
+          continue;
+
+        for (const auto &entry : (*p).second) {
+          Match match;
+
+          if (! std::get<0>(entry).match(name, match.stem))
+            continue;
+
+          match.rule = std::get<1>(entry);
+
+          matches1.emplace_back(std::get<2>(entry), match);
+        }
+      }
+
+      std::sort(matches1.begin(), matches1.end(),
+        [](const std::pair<int,Match> &m1, const std::pair<int,Match> &m2) {
+          if (m1.second.stem.size() != m2.second.stem.size())
+            return m1.second.stem.size() < m2.second.stem.size();
+
+          return m1.first < m2.first;
+        });
+
+      for (const auto &m : matches1)
+        matches.push_back(m.second);
+    }
+
+   private:
+    using Entry    = std::tuple<Pattern,Rule *,int>;
+    using Entries  = std::vector<Entry>;
+    using Suffixes = std::unordered_map<std::string,Entries>;
+    using Lens     = std::vector<size_t>;
+
+    Suffixes  bySuffix_;
+    Lens      suffixLens_;
+    RuleArray rules_;
+  };
+
+  // conditional block (active includes enclosing blocks, taken is set once
+  // any branch has been selected)
   struct Block {
-    Block(bool active=false) :
-     active(active) {
+    Block(bool active=false, bool parentActive=true) :
+     active(active), parentActive(parentActive), taken(active) {
     }
 
-    bool active { false };
+    bool active       { false };
+    bool parentActive { true };
+    bool taken        { false };
   };
 
   using Blocks = std::vector<Block>;
 
-  bool      quiet_ { false };
-  bool      debug_ { false };
-  Variables variables_;
-  Rules     rules_;
-  Rule*     rule_    { nullptr };
-  Rule*     defRule_ { nullptr };
-  Blocks    blocks_;
+  using TargetStates = std::unordered_map<const Rule *,TargetState>;
+  using RuleStack    = std::vector<const Rule *>;
+  using FileStats    = std::vector<FileStat>;
+  using FileIds      = std::unordered_set<SymbolId>;
+  using DirListings  = std::unordered_map<std::string,DirListing>;
+  using ShellProgs   = std::unordered_set<std::string>;
+  using VPathDirs    = std::vector<std::string>;
+  using ExportIds    = std::unordered_map<SymbolId,bool>;
+
+  // environment variable lookup (for parse cache validation)
+  struct EnvLookup {
+    bool        exists { false };
+    std::string value;
+  };
+
+  using EnvLookups = std::unordered_map<std::string,EnvLookup>;
+
+  // vpath directive (dirs searched for files matching pattern)
+  struct VPath {
+    std::string pattern;
+    VPathDirs   dirs;
+  };
+
+  using VPaths     = std::vector<VPath>;
+  using VPathFiles = std::unordered_map<SymbolId,SymbolId>;
+  using ShellResults = std::unordered_map<std::string,std::string>;
+
+  // include scan of file (valid while file time unchanged)
+  struct IncludeScan {
+    FileTime mtime { 0 };
+    Includes includes;
+  };
+
+  using ScanSuffixes     = std::unordered_set<std::string>;
+  using IncludeScans     = std::unordered_map<SymbolId,IncludeScan>;
+  using ResolvedIncludes = std::unordered_map<SymbolId,SymbolIds>;
+  using DirsIncludes     = std::unordered_map<std::string,ResolvedIncludes>;
+  using RuleIncludes     = std::unordered_map<const Rule *,SymbolIds>;
+  using RuleIncludeDirs  = std::unordered_map<const Rule *,IncludeDirs>;
+  using ArtifactKeys     = std::unordered_map<const Rule *,std::string>;
+
+  // build database record for target (last built command and input times
+  // and, in content hash mode, input hashes)
+  struct BuildRecord {
+    struct Input {
+      SymbolId id    { NO_SYMBOL };
+      FileTime mtime { 0 };
+      uint64_t hash  { 0 };
+
+      Input(SymbolId id=NO_SYMBOL, FileTime mtime=0, uint64_t hash=0) :
+       id(id), mtime(mtime), hash(hash) {
+      }
+    };
+
+    using Inputs = std::vector<Input>;
+
+    uint64_t cmdHash      { 0 };
+    bool     volatileCmds { false }; // expansion ran $(shell) or $(wildcard)
+    Inputs   inputs;
+  };
+
+  using BuildRecords = std::unordered_map<SymbolId,BuildRecord>;
+  using RuleCmds     = std::unordered_map<const Rule *,ExecCmds>;
+  using RuleSet      = std::unordered_set<const Rule *>;
+
+  bool         quiet_     { false };
+  bool         debug_     { false };
+  int          numJobs_   { 1 };
+  bool         keepGoing_ { false };
+  std::mutex   outputMutex_;
+  Arena        arena_;
+  mutable Symbols symbols_;
+  Variables    variables_;
+  mutable Variables tempVariables_; // foreach/call variables of undefined names
+  Rules        rules_;
+  Rule*        rule_    { nullptr };
+  Rule*        defRule_ { nullptr };
+  bool         newRuleCmds_ { false };
+  Blocks       blocks_;
+  TargetStates targetStates_;
+  RuleStack    ruleStack_;
+  mutable FileStats fileStats_;
+  mutable DirListings dirListings_;
+  FileIds      lowResTimeFiles_;
+  PatternIndex patternRules_;
+  std::vector<std::string> suffixes_;
+  ShellProgs   shellProgs_;
+  bool         shellCacheAll_ { false };
+  mutable ShellResults shellResults_;
+  mutable int  volatileCalls_ { 0 }; // $(shell) (not .SHELL_CACHE) and $(wildcard) calls
+  mutable bool parsePureShell_ { false };
+  VPaths       vpaths_;
+  int          parseDepth_ { 0 };
+  mutable bool       vpathVarSet_ { false };
+  mutable VPathDirs  vpathVarDirs_;
+  mutable VPathFiles vpathFiles_;
+  ExportIds    exports_;
+  mutable EnvLookups envLookups_;
+  bool         exportAll_ { false };
+  mutable CommandEnvP commandEnv_;
+  mutable bool envDirty_        { true };
+  mutable bool envBuilding_     { false };
+  mutable bool deferredExports_ { false };
+  mutable Rules implicitRules_;
+  bool         scanIncludes_ { false };
+  ScanSuffixes scanSuffixes_;
+  std::string  includeCacheFile_;
+  bool         includeCacheLoaded_ { false };
+  bool         includeCacheDirty_  { false };
+  IncludeScans includeScans_;
+  DirsIncludes dirsIncludes_;
+  RuleIncludes ruleIncludes_;
+  mutable RuleIncludeDirs ruleIncludeDirs_;
+  SymbolIds    makefiles_;
+  std::string  buildDbFile_;
+  BuildRecords buildRecords_;
+  bool         buildDbDirty_     { false };
+  bool         cmdInputsChanged_ { true }; // makefiles, command line or environment
+  mutable RuleSet volatileCmds_;
+  RuleCmds     expandedCmds_;
+  bool         contentHash_      { false };
+  std::string  artifactDir_;
+  uint64_t     artifactMaxSize_ { 0 };
+  bool         artifactLink_    { false };
+  ArtifactKeys artifactKeys_;
+  ArtifactStats artifactStats_;
 };
 
 #endif